@@ -0,0 +1,72 @@
+#include "allocationCounter.h"
+#include "memoryTracker.h"
+
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+
+namespace
+{
+	// ALW - Plain statics, so they are ready before any other static needs operator new. The watched thread is
+	// ALW - set before any other thread starts, and only that thread changes the count.
+	std::thread::id	watchedThread;
+	std::size_t		allocationCount = 0;
+}
+
+void AllocationCounter::watchCurrentThread()
+{
+	watchedThread = std::this_thread::get_id();
+}
+
+bool AllocationCounter::isWatchedThread()
+{
+	return std::this_thread::get_id() == watchedThread;
+}
+
+std::size_t AllocationCounter::getCount()
+{
+	return allocationCount;
+}
+
+void AllocationCounter::recordAllocation()
+{
+	if (isWatchedThread())
+		++allocationCount;
+}
+
+// ALW - The replacement costs every allocation in the program, so it is only built with MOKA_TRACK_ALLOCATIONS, which
+// ALW - the Debug configuration defines. Without it the count stays at zero.
+#ifdef MOKA_TRACK_ALLOCATIONS
+void * operator new(std::size_t size)
+{
+	AllocationCounter::recordAllocation();
+
+	// ALW - malloc(0) may return a null pointer, but operator new must return a unique pointer.
+	void *memory = std::malloc(0 == size ? 1 : size);
+	if (!memory)
+		throw std::bad_alloc();
+
+	MemoryTracker::recordAllocation(memory, size);
+	return memory;
+}
+
+void * operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *memory) throw()
+{
+	if (!memory)
+		return;
+
+	MemoryTracker::recordFree(memory);
+	std::free(memory);
+}
+
+void operator delete[](void *memory) throw()
+{
+	operator delete(memory);
+}
+#endif
@@ -0,0 +1,21 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+
+// ALW - Counts the heap allocations made through the global operator new, which allocationCounter.cpp replaces when
+// ALW - MOKA_TRACK_ALLOCATIONS is defined. Only the watched thread is counted, because the preview worker and SFML's
+// ALW - audio threads allocate on their own schedule. Once the scene is built a normal frame should not allocate, and
+// ALW - World::update() asserts as much in tracking builds by comparing the count before and after the frame.
+class AllocationCounter
+{
+public:
+	static void					watchCurrentThread();
+	static bool					isWatchedThread();
+	static std::size_t			getCount();		// ALW - Allocations made on the watched thread so far
+
+	static void					recordAllocation();
+};
+
+#endif
@@ -1,5 +1,11 @@
 #include "application.h"
+#include "allocationCounter.h"
+#include "eventIdentifiers.h"
+#include "framePacer.h"
+#include "memoryTracker.h"
+#include "voicePool.h"
 
+#include "../Resources/assetCache.h"
 #include "../Resources/resourceIdentifiers.h"
 #include "../States/gameState.h"
 #include "../States/menuState.h"
@@ -13,51 +19,93 @@
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/VideoMode.hpp>
 
+#include <fstream>
+#include <iostream>
 #include <string>
 
 
+namespace
+{
+	// ALW - 0 when the file cannot be opened, in which case loading it has already thrown.
+	std::size_t getFileSize(const std::string &filename)
+	{
+		std::ifstream file(filename, std::ios::binary | std::ios::ate);
+		return file ? static_cast<std::size_t>(file.tellg()) : 0u;
+	}
+}
+
 const sf::Time Application::TimePerFrame = sf::seconds(1.f / 60.f);
+const Application::FramePacing Application::Pacing = Application::FramePacing::Capped;
+const unsigned int Application::FrameLimit = 60u;
 
 Application::Application()
 : mWindow(sf::VideoMode(800, 600), "Moka", sf::Style::Close)
-, mTextures()
 , mFonts()
 , mPlayer()
 , mMusic()
 , mSounds()
-, mStateStack(trmb::State::Context(mWindow, mTextures, mFonts, mPlayer, mMusic, mSounds))
+, mVoicePool()
+, mStateStack(trmb::State::Context(mWindow, AssetCache::getInstance().getTextures(), mFonts, mPlayer, mMusic, mSounds))
 , mStatisticsText()
 , mStatisticsUpdateTime()
 , mStatisticsNumFrames(0)
 , mToggleFullscreen(mWindow)
 , mUpdateSkipped(false)
+, mAnimating(true)
 {
+	// ALW - Every frame runs on this thread.
+	AllocationCounter::watchCurrentThread();
+	Events::verifyGuids();
+
 	mWindow.setKeyRepeatEnabled(false);
+	applyFramePacing();
+
+	MemoryTracker::loadBudgets("Data/Memory/Budgets.xml");
+
+	{
+		MemoryTracker::Scope scope(MemoryTracker::Fonts);
+		mFonts.load(Fonts::ID::Main, "Data/Fonts/Sansation-Regular.ttf");
+		mFonts.load(Fonts::ID::Title, "Data/Fonts/Flavors-Regular.ttf");
 
-	mFonts.load(Fonts::ID::Main, "Data/Fonts/Sansation-Regular.ttf");
-	mFonts.load(Fonts::ID::Title, "Data/Fonts/Flavors-Regular.ttf");
+		// ALW - FreeType reads the font files inside the SFML DLL, where operator new never sees them.
+		MemoryTracker::recordExternal(MemoryTracker::Fonts, getFileSize("Data/Fonts/Sansation-Regular.ttf")
+			+ getFileSize("Data/Fonts/Flavors-Regular.ttf"));
+	}
 
-	mTextures.load(Textures::ID::TitleScreen, "Data/Textures/TitleScreen.png");
-	mTextures.load(Textures::ID::MenuScreen, "Data/Textures/MenuScreen.png");
-	mTextures.load(Textures::ID::Buttons, "Data/Textures/Buttons.png");
-	mTextures.load(Textures::ID::KeyboardArrowUp, "Data/Textures/KeyboardArrowUp.png");
-	mTextures.load(Textures::ID::KeyboardArrowDown, "Data/Textures/KeyboardArrowDown.png");
-	mTextures.load(Textures::ID::KeyboardArrowLeft, "Data/Textures/KeyboardArrowLeft.png");
-	mTextures.load(Textures::ID::KeyboardArrowRight, "Data/Textures/KeyboardArrowRight.png");
-	mTextures.load(Textures::ID::KeyboardMouseLeft, "Data/Textures/KeyboardMouseLeft.png");
-	mTextures.load(Textures::ID::KeyboardEsc, "Data/Textures/KeyboardEsc.png");
-	mTextures.load(Textures::ID::KeyboardCtrl, "Data/Textures/KeyboardCtrl.png");
-	mTextures.load(Textures::ID::KeyboardF, "Data/Textures/KeyboardF.png");
+	{
+		AssetCache &assetCache = AssetCache::getInstance();
+		assetCache.loadTexture(Textures::ID::TitleScreen, "Data/Textures/TitleScreen.png");
+		assetCache.loadTexture(Textures::ID::MenuScreen, "Data/Textures/MenuScreen.png");
+		assetCache.loadTexture(Textures::ID::Buttons, "Data/Textures/Buttons.png");
+		assetCache.loadTexture(Textures::ID::KeyboardArrowUp, "Data/Textures/KeyboardArrowUp.png");
+		assetCache.loadTexture(Textures::ID::KeyboardArrowDown, "Data/Textures/KeyboardArrowDown.png");
+		assetCache.loadTexture(Textures::ID::KeyboardArrowLeft, "Data/Textures/KeyboardArrowLeft.png");
+		assetCache.loadTexture(Textures::ID::KeyboardArrowRight, "Data/Textures/KeyboardArrowRight.png");
+		assetCache.loadTexture(Textures::ID::KeyboardMouseLeft, "Data/Textures/KeyboardMouseLeft.png");
+		assetCache.loadTexture(Textures::ID::KeyboardEsc, "Data/Textures/KeyboardEsc.png");
+		assetCache.loadTexture(Textures::ID::KeyboardCtrl, "Data/Textures/KeyboardCtrl.png");
+		assetCache.loadTexture(Textures::ID::KeyboardF, "Data/Textures/KeyboardF.png");
+	}
+
+	{
+		MemoryTracker::Scope scope(MemoryTracker::Sounds);
+		mMusic.load(Music::ID::WaitingII, "Data/Music/WaitingII.ogg");
+		mMusic.load(Music::ID::Krakatoa, "Data/Music/Krakatoa.ogg");
 
-	mMusic.load(Music::ID::WaitingII, "Data/Music/WaitingII.ogg");
-	mMusic.load(Music::ID::Krakatoa, "Data/Music/Krakatoa.ogg");
+		// ALW - Trambo's buttons play the button sound through trmb::SoundPlayer. The game plays the rest.
+		mSounds.load(SoundEffects::ID::Button, "Data/Sounds/Button.wav");
 
-	mSounds.load(SoundEffects::ID::Button, "Data/Sounds/Button.wav");
-	mSounds.load(SoundEffects::ID::Chat, "Data/Sounds/Chat.wav");
-	mSounds.load(SoundEffects::ID::Object, "Data/Sounds/Object.wav");
+		// ALW - Its samples live inside the SFML DLL, and trmb::SoundPlayer does not hand out the buffer, so the size of
+		// ALW - the 16-bit PCM file stands in for them. The voice pool adds its own buffers.
+		MemoryTracker::recordExternal(MemoryTracker::Sounds, getFileSize("Data/Sounds/Button.wav"));
+
+		mVoicePool.load(SoundEffects::ID::Chat, "Data/Sounds/Chat.wav", VoicePool::Priority::Normal);
+		mVoicePool.load(SoundEffects::ID::Object, "Data/Sounds/Object.wav", VoicePool::Priority::High);
+	}
 
 	mStatisticsText.setFont(mFonts.get(Fonts::ID::Main));
 	mStatisticsText.setPosition(5.f, 5.f);
@@ -73,6 +121,7 @@ void Application::run()
 {
 	sf::Clock clock;
 	sf::Time timeSinceLastUpdate = sf::Time::Zero;
+	bool redraw = true;
 
 	while (mWindow.isOpen())
 	{
@@ -82,7 +131,10 @@ void Application::run()
 		{
 			timeSinceLastUpdate -= TimePerFrame;
 
-			processInput();
+			// ALW - Input may change a button or the state stack, so the frame after it is always drawn.
+			if (processInput())
+				redraw = true;
+
 			update(TimePerFrame);
 
 			// ALW - An update may be skipped, because the application lost focus.
@@ -95,32 +147,66 @@ void Application::run()
 				if (mStateStack.isEmpty())
 					mWindow.close();
 			}
+
+			// ALW - Only an update that ran can ask for another frame.
+			mAnimating = !mUpdateSkipped && FramePacer::getInstance().takeAnimationRequest();
 		}
 
-		updateStatistics(dt);
-		render();
+		const bool rendered = mAnimating || redraw;
+		updateStatistics(dt, rendered);
+
+		if (rendered)
+		{
+			render();
+			redraw = false;
+		}
+		else
+		{
+			// ALW - Nothing on screen is changing, so sleep until the next fixed step instead of spinning. Input
+			// ALW - is only read on a fixed step, so this adds no latency.
+			sf::sleep(TimePerFrame - timeSinceLastUpdate);
+		}
 	}
+
+	MemoryTracker::report(std::cout);
 }
 
-void Application::processInput()
+bool Application::processInput()
 {
+	bool inputReceived = false;
+
 	sf::Event event;
 	while (mWindow.pollEvent(event))
 	{
-		mToggleFullscreen.handleEvent(event);
+		inputReceived = true;
+
+		// ALW - Creating the window again resets vertical sync.
+		if (mToggleFullscreen.handleEvent(event))
+			applyFramePacing();
+
+		// ALW - Ctrl + M prints the memory report.
+		if (event.type == sf::Event::KeyPressed && event.key.control && event.key.code == sf::Keyboard::M)
+			MemoryTracker::report(std::cout);
 
 		if (trmb::isWindowFocused(mWindow))
+		{
+			MemoryTracker::Scope scope(MemoryTracker::World);
 			mStateStack.handleEvent(event);
+		}
 
 		if (event.type == sf::Event::Closed)
 			mWindow.close();
 	}
+
+	return inputReceived;
 }
 
 void Application::update(sf::Time dt)
 {
 	if (trmb::isWindowFocused(mWindow))
 	{
+		// ALW - The GameState's World is built and updated here. Its parts tag themselves more narrowly.
+		MemoryTracker::Scope scope(MemoryTracker::World);
 		mStateStack.update(dt);
 		mUpdateSkipped = false;
 	}
@@ -141,16 +227,26 @@ void Application::render()
 	mWindow.display();
 }
 
-void Application::updateStatistics(sf::Time dt)
+void Application::applyFramePacing()
+{
+	mWindow.setVerticalSyncEnabled(FramePacing::VerticalSync == Pacing);
+	mWindow.setFramerateLimit(FramePacing::Capped == Pacing ? FrameLimit : 0u);
+}
+
+void Application::updateStatistics(sf::Time dt, bool rendered)
 {
 	mStatisticsUpdateTime += dt;
-	mStatisticsNumFrames += 1;
+	if (rendered)
+		mStatisticsNumFrames += 1;
+
 	if (mStatisticsUpdateTime >= sf::seconds(1.0f))
 	{
 		mStatisticsText.setString("FPS: " + std::to_string(mStatisticsNumFrames));
 
 		mStatisticsUpdateTime -= sf::seconds(1.0f);
 		mStatisticsNumFrames = 0;
+
+		MemoryTracker::warnOverBudget(std::cout);
 	}
 }
 
@@ -2,6 +2,7 @@
 #define APPLICATION_H
 
 #include "toggleFullscreen.h"
+#include "voicePool.h"
 #include "../Player/player.h"
 
 #include "Trambo/Resources/resourceHolder.h"
@@ -16,30 +17,43 @@
 
 class Application
 {
+public:
+	// ALW - How a frame that animates is paced. Frames that do not animate are never drawn.
+	enum FramePacing
+	{
+		Uncapped,
+		Capped,			// ALW - At most FrameLimit frames a second
+		VerticalSync,
+	};
+
+
 public:
 							Application();
 	void					run();
 
 
 private:
-	void					processInput();
+	bool					processInput();		// ALW - Returns true if there was any input
 	void					update(sf::Time dt);
 	void					render();
 
-	void					updateStatistics(sf::Time dt);
+	void					applyFramePacing();
+	void					updateStatistics(sf::Time dt, bool rendered);
 	void					registerStates();
 
 
 private:
-	static const sf::Time	TimePerFrame;
+	static const sf::Time		TimePerFrame;
+	static const FramePacing	Pacing;
+	static const unsigned int	FrameLimit;
 
 	sf::RenderWindow		mWindow;
-	trmb::TextureHolder		mTextures;
 	trmb::FontHolder		mFonts;
 	Player					mPlayer;
 
 	trmb::MusicPlayer		mMusic;
 	trmb::SoundPlayer		mSounds;
+	VoicePool				mVoicePool;		// ALW - Before the state stack, so it outlives the World playing on it
 	trmb::StateStack		mStateStack;
 
 	sf::Text				mStatisticsText;
@@ -48,6 +62,7 @@ private:
 
 	ToggleFullscreen		mToggleFullscreen;
 	bool					mUpdateSkipped;
+	bool					mAnimating;
 };
 
 #endif
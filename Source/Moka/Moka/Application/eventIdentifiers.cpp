@@ -0,0 +1,71 @@
+#include "eventIdentifiers.h"
+
+#include <cassert>
+
+
+namespace
+{
+	Events::EventGuid hashName(const char *name)
+	{
+		// ALW - 32-bit FNV-1a
+		unsigned long hash = 0x811c9dc5;
+		for (; *name != '\0'; ++name)
+		{
+			hash ^= static_cast<unsigned char>(*name);
+			hash = (hash * 0x01000193) & 0xffffffff;
+		}
+
+		return hash;
+	}
+}
+
+const char * Events::getName(EventGuid type)
+{
+	switch (type)
+	{
+	case Up:				return "Up";
+	case Down:				return "Down";
+	case Left:				return "Left";
+	case Right:				return "Right";
+	case Enter:				return "Enter";
+	case LeftClickPress:	return "LeftClickPress";
+	case LeftClickRelease:	return "LeftClickRelease";
+	case RightClick:		return "RightClick";
+	case Fullscreen:		return "Fullscreen";
+	case Windowed:			return "Windowed";
+	case BeginSimulation:	return "BeginSimulation";
+	case BeginScoreboard:	return "BeginScoreboard";
+	case CreateTextPrompt:	return "CreateTextPrompt";
+	case ClearTextPrompt:	return "ClearTextPrompt";
+	case DrawBarrelUI:		return "DrawBarrelUI";
+	case DoNotDrawBarrelUI:	return "DoNotDrawBarrelUI";
+	case DrawClinicUI:		return "DrawClinicUI";
+	case DoNotDrawClinicUI:	return "DoNotDrawClinicUI";
+	case DrawDoorUI:		return "DrawDoorUI";
+	case DoNotDrawDoorUI:	return "DoNotDrawDoorUI";
+	case DrawHouseUI:		return "DrawHouseUI";
+	case DoNotDrawHouseUI:	return "DoNotDrawHouseUI";
+	case DrawWindowUI:		return "DrawWindowUI";
+	case DoNotDrawWindowUI:	return "DoNotDrawWindowUI";
+	default:				return nullptr;
+	}
+}
+
+void Events::verifyGuids()
+{
+	const EventGuid events[] =
+	{
+		Up, Down, Left, Right, Enter, LeftClickPress, LeftClickRelease, RightClick,
+		Fullscreen, Windowed,
+		BeginSimulation, BeginScoreboard, CreateTextPrompt, ClearTextPrompt,
+		DrawBarrelUI, DoNotDrawBarrelUI, DrawClinicUI, DoNotDrawClinicUI, DrawDoorUI, DoNotDrawDoorUI,
+		DrawHouseUI, DoNotDrawHouseUI, DrawWindowUI, DoNotDrawWindowUI,
+	};
+
+	for (const EventGuid type : events)
+	{
+		const char *name = getName(type);
+		assert(("The event is missing from getName()!", name != nullptr));
+		assert(("The event's GUID is not the hash of its name!", name == nullptr || hashName(name) == type));
+	}
+}
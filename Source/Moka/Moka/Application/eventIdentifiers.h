@@ -0,0 +1,49 @@
+#ifndef EVENT_IDENTIFIERS_H
+#define EVENT_IDENTIFIERS_H
+
+
+// ALW - Every game event is declared here, once, by name. Its GUID is the 32-bit FNV-1a hash of that name. VS2013 has
+// ALW - no constexpr, so the hashes are written out by hand. verifyGuids() checks each one against its name at startup,
+// ALW - and two events with the same GUID are duplicate case labels in getName(), which fails the build. To add an
+// ALW - event, add its constant, its case in getName(), and its entry in verifyGuids().
+namespace Events
+{
+	typedef unsigned long	EventGuid;
+
+	// ALW - Input, bound to keys and mouse buttons by the Controller
+	const EventGuid			Up					= 0x42f35940;
+	const EventGuid			Down				= 0xa4995035;
+	const EventGuid			Left				= 0x92773890;
+	const EventGuid			Right				= 0x1e9e9f85;
+	const EventGuid			Enter				= 0xaff863ad;
+	const EventGuid			LeftClickPress		= 0x4591868f;
+	const EventGuid			LeftClickRelease	= 0xcdf0a2c5;
+	const EventGuid			RightClick			= 0x242b08cf;
+
+	// ALW - Sent by the ToggleFullscreen class
+	const EventGuid			Fullscreen			= 0x3d2aca78;
+	const EventGuid			Windowed			= 0xc0dc9b44;
+
+	// ALW - Sent by the DaylightUI, the World, and the ChatBoxUI
+	const EventGuid			BeginSimulation		= 0x8abd24f1;
+	const EventGuid			BeginScoreboard		= 0x373cf8b4;
+	const EventGuid			CreateTextPrompt	= 0xc9b26a0c;
+	const EventGuid			ClearTextPrompt		= 0xa966c497;
+
+	// ALW - Sent by each InteractiveNode to the UINode that draws its UI
+	const EventGuid			DrawBarrelUI		= 0x289ddef1;
+	const EventGuid			DoNotDrawBarrelUI	= 0xe79bed71;
+	const EventGuid			DrawClinicUI		= 0x15557315;
+	const EventGuid			DoNotDrawClinicUI	= 0xd4538195;
+	const EventGuid			DrawDoorUI			= 0xd861c9a1;
+	const EventGuid			DoNotDrawDoorUI		= 0x0efc9421;
+	const EventGuid			DrawHouseUI			= 0x9aa72713;
+	const EventGuid			DoNotDrawHouseUI	= 0x1053ee93;
+	const EventGuid			DrawWindowUI		= 0x6073dc09;
+	const EventGuid			DoNotDrawWindowUI	= 0x1f71ea89;
+
+	const char *			getName(EventGuid type);	// ALW - nullptr when the GUID is not declared here
+	void					verifyGuids();
+}
+
+#endif
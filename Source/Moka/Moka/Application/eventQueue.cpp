@@ -0,0 +1,42 @@
+#include "eventQueue.h"
+#include "eventIdentifiers.h"
+
+#include <cassert>
+
+
+EventQueue & EventQueue::getInstance()
+{
+	static EventQueue instance;
+	return instance;
+}
+
+EventQueue::EventQueue()
+: mPending()
+{
+	// ALW - A busy frame posts a handful of events, so posting never allocates once the game is running.
+	const std::size_t capacity = 64;
+	mPending.reserve(capacity);
+}
+
+void EventQueue::post(EventGuid type)
+{
+	assert(("The event is not declared in eventIdentifiers.h!", Events::getName(type) != nullptr));
+	mPending.push_back(type);
+}
+
+bool EventQueue::takeEvents(std::vector<EventGuid> &events)
+{
+	assert(("The events taken last time have not been sent!", events.empty()));
+
+	if (mPending.empty())
+		return false;
+
+	// ALW - The buffers trade places, so both keep their capacity.
+	mPending.swap(events);
+	return true;
+}
+
+void EventQueue::clear()
+{
+	mPending.clear();
+}
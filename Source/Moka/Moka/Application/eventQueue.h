@@ -0,0 +1,37 @@
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <vector>
+
+
+// ALW - Collects the game events raised during a frame, so they are not delivered from inside the handler that
+// ALW - raised them. trmb::EventHandler::sendEvent() delivers at once, which meant a click could select an object
+// ALW - whose chat text disabled every other object's input before they saw the same click. The World takes the
+// ALW - events at fixed points of its update and sends them in the order they were posted. An event posted while
+// ALW - a batch is being sent goes out in the next batch.
+class EventQueue
+{
+public:
+	typedef unsigned long	EventGuid;
+
+
+public:
+	static EventQueue &		getInstance();
+
+							EventQueue(const EventQueue &) = delete;
+	EventQueue &			operator=(const EventQueue &) = delete;
+
+	void					post(EventGuid type);
+	bool					takeEvents(std::vector<EventGuid> &events);	// ALW - Swaps in the pending events. False if there are none.
+	void					clear();
+
+
+private:
+							EventQueue();
+
+
+private:
+	std::vector<EventGuid>	mPending;
+};
+
+#endif
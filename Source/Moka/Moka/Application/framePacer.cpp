@@ -0,0 +1,26 @@
+#include "framePacer.h"
+
+
+FramePacer & FramePacer::getInstance()
+{
+	static FramePacer instance;
+	return instance;
+}
+
+FramePacer::FramePacer()
+: mAnimationRequested(false)
+{
+}
+
+void FramePacer::requestAnimation()
+{
+	mAnimationRequested = true;
+}
+
+bool FramePacer::takeAnimationRequest()
+{
+	const bool animationRequested = mAnimationRequested;
+	mAnimationRequested = false;
+
+	return animationRequested;
+}
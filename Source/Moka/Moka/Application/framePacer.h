@@ -0,0 +1,28 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+
+// ALW - Lets a state tell the Application that what it draws is still changing. The title, menu, and pause
+// ALW - screens only change when the player does something, so the Application skips rendering and sleeps between
+// ALW - fixed steps unless an update asked for another frame or input arrived.
+class FramePacer
+{
+public:
+	static FramePacer &		getInstance();
+
+							FramePacer(const FramePacer &) = delete;
+	FramePacer &			operator=(const FramePacer &) = delete;
+
+	void					requestAnimation();
+	bool					takeAnimationRequest();		// ALW - Clears the request
+
+
+private:
+							FramePacer();
+
+
+private:
+	bool					mAnimationRequested;
+};
+
+#endif
@@ -0,0 +1,333 @@
+#include "memoryTracker.h"
+#include "allocationCounter.h"
+
+#include "../../../3rdParty/TinyXML2/tinyxml2.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+
+
+namespace
+{
+	struct Entry
+	{
+		void					*memory;		// ALW - nullptr when the slot is empty
+		std::size_t				size;
+		MemoryTracker::Tag		tag;
+	};
+
+	// ALW - One open addressing hash table keyed by block address per shard, so the main thread, the preview
+	// ALW - worker and the forks rarely wait on each other. A table lives in malloc() memory, so it never calls back
+	// ALW - into operator new, and a spin lock guards it, because std::mutex may allocate. A block is freed through
+	// ALW - the shard it was recorded in, whichever thread frees it.
+	struct Shard
+	{
+		std::atomic<bool>		locked;
+		Entry					*table;
+		std::size_t				tableSize;		// ALW - A power of two
+		std::size_t				entryCount;
+	};
+
+	const std::size_t			shardCount = 16;	// ALW - A power of two
+
+	// ALW - Plain statics, so they are ready before any other static needs operator new.
+	Shard						shards[shardCount];
+
+	std::atomic<std::size_t>	currentBytes[MemoryTracker::TagCount];
+	std::atomic<std::size_t>	peakBytes[MemoryTracker::TagCount];
+	std::size_t					budgetBytes[MemoryTracker::TagCount];
+	bool						warned[MemoryTracker::TagCount];
+	MemoryTracker::Tag			currentTag = MemoryTracker::Other;	// ALW - Only the watched thread reads or writes it
+
+	class ShardLock
+	{
+	public:
+		explicit ShardLock(Shard &shard)
+		: mShard(shard)
+		{
+			while (mShard.locked.exchange(true, std::memory_order_acquire))
+				std::this_thread::yield();
+		}
+
+		~ShardLock()
+		{
+			mShard.locked.store(false, std::memory_order_release);
+		}
+
+
+	private:
+		Shard					&mShard;
+	};
+
+	std::size_t getHash(const void *memory)
+	{
+		// ALW - Blocks are at least 8 byte aligned, so the low bits carry nothing.
+		const std::size_t address = reinterpret_cast<std::size_t>(memory) >> 3;
+		return address * 2654435761u;
+	}
+
+	Shard & getShard(const void *memory)
+	{
+		// ALW - The high bits pick the shard and the low bits the slot, so a shard's blocks still spread over its table.
+		return shards[(getHash(memory) >> 24) & (shardCount - 1)];
+	}
+
+	std::size_t getHome(const void *memory, std::size_t size)
+	{
+		return getHash(memory) & (size - 1);
+	}
+
+	void insert(Entry *entries, std::size_t size, const Entry &entry)
+	{
+		std::size_t index = getHome(entry.memory, size);
+		while (entries[index].memory)
+			index = (index + 1) & (size - 1);
+
+		entries[index] = entry;
+	}
+
+	bool grow(Shard &shard)
+	{
+		const std::size_t minimumSize = 256;
+		const std::size_t newSize = 0 == shard.tableSize ? minimumSize : shard.tableSize * 2;
+
+		Entry *newTable = static_cast<Entry *>(std::calloc(newSize, sizeof(Entry)));
+		if (!newTable)
+			return false;
+
+		for (std::size_t i = 0; i < shard.tableSize; ++i)
+		{
+			if (shard.table[i].memory)
+				insert(newTable, newSize, shard.table[i]);
+		}
+
+		std::free(shard.table);
+		shard.table = newTable;
+		shard.tableSize = newSize;
+
+		return true;
+	}
+
+	void add(MemoryTracker::Tag tag, std::size_t bytes)
+	{
+		const std::size_t current = currentBytes[tag].fetch_add(bytes) + bytes;
+
+		std::size_t peak = peakBytes[tag].load();
+		while (peak < current && !peakBytes[tag].compare_exchange_weak(peak, current))
+			;
+	}
+
+	void subtract(MemoryTracker::Tag tag, std::size_t bytes)
+	{
+		currentBytes[tag].fetch_sub(bytes);
+	}
+
+	double toMegabytes(std::size_t bytes)
+	{
+		return bytes / (1024.0 * 1024.0);
+	}
+}
+
+MemoryTracker::Scope::Scope(Tag tag)
+: mPrevious(setTag(tag))
+{
+}
+
+MemoryTracker::Scope::~Scope()
+{
+	setTag(mPrevious);
+}
+
+MemoryTracker::Tag MemoryTracker::setTag(Tag tag)
+{
+	const Tag previous = currentTag;
+	currentTag = tag;
+
+	return previous;
+}
+
+const char * MemoryTracker::getName(Tag tag)
+{
+	switch (tag)
+	{
+	case Tag::Other:		return "Other";
+	case Tag::World:		return "World";
+	case Tag::SceneGraph:	return "SceneGraph";
+	case Tag::Mosquitoes:	return "Mosquitoes";
+	case Tag::HUD:			return "HUD";
+	case Tag::Textures:		return "Textures";
+	case Tag::Fonts:		return "Fonts";
+	case Tag::Sounds:		return "Sounds";
+	case Tag::Map:			return "Map";
+	default:
+		assert(("The tag is invalid!", false));
+		return "";
+	}
+}
+
+MemoryTracker::Usage MemoryTracker::getUsage(Tag tag)
+{
+	const Usage usage = { currentBytes[tag].load(), peakBytes[tag].load(), budgetBytes[tag] };
+	return usage;
+}
+
+void MemoryTracker::loadBudgets(const std::string &filename)
+{
+	tinyxml2::XMLDocument config;
+	if (config.LoadFile(filename.c_str()) == tinyxml2::XML_ERROR_FILE_NOT_FOUND)
+		return;
+
+	const tinyxml2::XMLElement *element = config.FirstChildElement("budgets");
+	if (element == nullptr)
+	{
+		throw std::runtime_error("ALW - Runtime Error: Failed to read budgets element in " + filename);
+	}
+
+	for (element = element->FirstChildElement("budget"); element != nullptr; element = element->NextSiblingElement("budget"))
+	{
+		const char *name = element->Attribute("tag");
+		double megabytes = 0.0;
+
+		if (name == nullptr || element->QueryDoubleAttribute("megabytes", &megabytes) != tinyxml2::XML_NO_ERROR || megabytes < 0.0)
+		{
+			throw std::runtime_error("ALW - Runtime Error: Failed to read budget element in " + filename);
+		}
+
+		int tag = Tag::Other;
+		while (tag < Tag::TagCount && std::strcmp(name, getName(static_cast<Tag>(tag))) != 0)
+			++tag;
+
+		if (tag == Tag::TagCount)
+		{
+			throw std::runtime_error("ALW - Runtime Error: The budget tag " + std::string(name) + " does not exist.");
+		}
+
+		budgetBytes[tag] = static_cast<std::size_t>(megabytes * 1024.0 * 1024.0);
+		warned[tag] = false;
+	}
+}
+
+void MemoryTracker::recordExternal(Tag tag, std::size_t bytes)
+{
+	add(tag, bytes);
+}
+
+void MemoryTracker::releaseExternal(Tag tag, std::size_t bytes)
+{
+	subtract(tag, bytes);
+}
+
+void MemoryTracker::report(std::ostream &stream)
+{
+#ifndef MOKA_TRACK_ALLOCATIONS
+	// ALW - Only recordExternal() reaches the counts, so a table would understate every tag.
+	stream << "\nMemory tracking is only built with MOKA_TRACK_ALLOCATIONS.\n";
+#else
+	std::size_t totalCurrent = 0;
+	std::size_t totalPeak = 0;
+
+	stream << "\nMemory (MB)      Current       Peak     Budget\n";
+	stream << std::fixed << std::setprecision(1);
+
+	for (int tag = 0; tag < Tag::TagCount; ++tag)
+	{
+		const Usage usage = getUsage(static_cast<Tag>(tag));
+		totalCurrent += usage.current;
+		totalPeak += usage.peak;	// ALW - The tags peak at different times, so this is an upper bound
+
+		stream << std::left << std::setw(12) << getName(static_cast<Tag>(tag)) << std::right
+			<< std::setw(11) << toMegabytes(usage.current) << std::setw(11) << toMegabytes(usage.peak);
+
+		if (usage.budget)
+			stream << std::setw(11) << toMegabytes(usage.budget);
+
+		stream << (usage.budget && usage.peak > usage.budget ? "  over budget\n" : "\n");
+	}
+
+	stream << std::left << std::setw(12) << "Total" << std::right
+		<< std::setw(11) << toMegabytes(totalCurrent) << std::setw(11) << toMegabytes(totalPeak) << "\n";
+#endif
+}
+
+void MemoryTracker::warnOverBudget(std::ostream &stream)
+{
+	for (int tag = 0; tag < Tag::TagCount; ++tag)
+	{
+		const Usage usage = getUsage(static_cast<Tag>(tag));
+		if (warned[tag] || !usage.budget || usage.current <= usage.budget)
+			continue;
+
+		warned[tag] = true;
+		stream << std::fixed << std::setprecision(1) << "\nWARNING: " << getName(static_cast<Tag>(tag)) << " is using "
+			<< toMegabytes(usage.current) << " MB of its " << toMegabytes(usage.budget) << " MB memory budget." << std::endl;
+	}
+}
+
+#ifdef MOKA_TRACK_ALLOCATIONS
+void MemoryTracker::recordAllocation(void *memory, std::size_t size)
+{
+	const Tag tag = AllocationCounter::isWatchedThread() ? currentTag : Tag::Other;
+	Shard &shard = getShard(memory);
+
+	{
+		ShardLock lock(shard);
+
+		// ALW - Keep the table at most three quarters full. A block that cannot be recorded is simply not counted.
+		if ((shard.entryCount + 1) * 4 > shard.tableSize * 3 && !grow(shard))
+			return;
+
+		const Entry entry = { memory, size, tag };
+		insert(shard.table, shard.tableSize, entry);
+		++shard.entryCount;
+	}
+
+	add(tag, size);
+}
+
+void MemoryTracker::recordFree(void *memory)
+{
+	Shard &shard = getShard(memory);
+	Entry entry = { nullptr, 0, Tag::Other };
+
+	{
+		ShardLock lock(shard);
+		if (0 == shard.tableSize)
+			return;
+
+		Entry *table = shard.table;
+		const std::size_t mask = shard.tableSize - 1;
+		std::size_t hole = getHome(memory, shard.tableSize);
+		while (table[hole].memory && table[hole].memory != memory)
+			hole = (hole + 1) & mask;
+
+		// ALW - Not ours, like a block allocated inside an SFML DLL.
+		if (!table[hole].memory)
+			return;
+
+		entry = table[hole];
+		--shard.entryCount;
+
+		// ALW - Backward shift deletion. An entry after the hole moves into it unless its home lies between the hole
+		// ALW - and the entry, which would put it before its home.
+		for (std::size_t next = (hole + 1) & mask; table[next].memory; next = (next + 1) & mask)
+		{
+			const std::size_t home = getHome(table[next].memory, shard.tableSize);
+			if (((next - home) & mask) >= ((next - hole) & mask))
+			{
+				table[hole] = table[next];
+				hole = next;
+			}
+		}
+
+		table[hole].memory = nullptr;
+	}
+
+	subtract(entry.tag, entry.size);
+}
+#endif
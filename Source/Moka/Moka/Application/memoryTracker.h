@@ -0,0 +1,73 @@
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+
+// ALW - Current and peak heap bytes per subsystem, counted in builds with MOKA_TRACK_ALLOCATIONS. The global operator
+// ALW - new in allocationCounter.cpp records every block under the tag of the thread's innermost Scope, and operator
+// ALW - delete charges the block back to the tag it was allocated under. Blocks are looked up in a side table kept
+// ALW - with malloc(), because blocks allocated inside the SFML DLLs are also freed here and carry no header of ours.
+// ALW - For the same reason the pixels of a texture, the font files, and the sound samples are never seen by operator
+// ALW - new, so they are added with recordExternal().
+class MemoryTracker
+{
+public:
+	enum Tag
+	{
+		Other		= 0,	// ALW - Untagged, or made on another thread
+		World		= 1,
+		SceneGraph	= 2,
+		Mosquitoes	= 3,
+		HUD			= 4,
+		Textures	= 5,
+		Fonts		= 6,
+		Sounds		= 7,
+		Map			= 8,	// ALW - The TinyXML-2 document and the objects read from it
+		TagCount
+	};
+
+	struct Usage
+	{
+		std::size_t			current;
+		std::size_t			peak;
+		std::size_t			budget;		// ALW - 0 when there is no budget
+	};
+
+	// ALW - Tags the watched thread's allocations until it is destroyed, then restores the tag it replaced.
+	class Scope
+	{
+	public:
+		explicit			Scope(Tag tag);
+							Scope(const Scope &) = delete;
+		Scope &				operator=(const Scope &) = delete;
+							~Scope();
+
+
+	private:
+		const Tag			mPrevious;
+	};
+
+
+public:
+	static Tag				setTag(Tag tag);		// ALW - Returns the tag it replaced
+	static const char *		getName(Tag tag);
+	static Usage			getUsage(Tag tag);
+
+	// ALW - A missing file means there are no budgets. A malformed one throws std::runtime_error.
+	static void				loadBudgets(const std::string &filename);
+	static void				recordExternal(Tag tag, std::size_t bytes);
+	static void				releaseExternal(Tag tag, std::size_t bytes);
+
+	static void				report(std::ostream &stream);
+	static void				warnOverBudget(std::ostream &stream);	// ALW - Once per tag, the first time it goes over
+
+#ifdef MOKA_TRACK_ALLOCATIONS
+	static void				recordAllocation(void *memory, std::size_t size);
+	static void				recordFree(void *memory);
+#endif
+};
+
+#endif
@@ -1,18 +1,17 @@
 #include "ToggleFullscreen.h"
+#include "eventIdentifiers.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 
 
 ToggleFullscreen::ToggleFullscreen(sf::RenderWindow &window)
-: mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mWindow(window)
+: mWindow(window)
 , mIsFullscreen(false)
 {
 }
 
-void ToggleFullscreen::handleEvent(const sf::Event &inputEvent)
+bool ToggleFullscreen::handleEvent(const sf::Event &inputEvent)
 {
 	if (inputEvent.type == sf::Event::KeyPressed)
 	{
@@ -23,15 +22,19 @@ void ToggleFullscreen::handleEvent(const sf::Event &inputEvent)
 			if (mIsFullscreen)
 			{
 				mWindow.create(sf::VideoMode::getFullscreenModes().front(), "Moka", sf::Style::Fullscreen);
-				EventHandler::sendEvent(mFullscreen);
+				EventHandler::sendEvent(trmb::Event(Events::Fullscreen));
 			}
 			else
 			{
 				mWindow.create(sf::VideoMode(800, 600), "Moka", sf::Style::Close);
-				EventHandler::sendEvent(mWindowed);
+				EventHandler::sendEvent(trmb::Event(Events::Windowed));
 			}
+
+			return true;
 		}
 	}
+
+	return false;
 }
 
 void ToggleFullscreen::handleEvent(const trmb::Event &)
@@ -18,14 +18,11 @@ public:
 							ToggleFullscreen(const ToggleFullscreen &) = delete;
 	ToggleFullscreen &		operator=(const ToggleFullscreen &) = delete;
 
-	void					handleEvent(const sf::Event &inputEvent);
+	bool					handleEvent(const sf::Event &inputEvent);	// ALW - Returns true if the window was created again
 	virtual void			handleEvent(const trmb::Event &) final; // ALW - This class does not handle events.  It only sends them.
 
 
 private:
-	const trmb::Event		mFullscreen;
-	const trmb::Event		mWindowed;
-
 	sf::RenderWindow		&mWindow;
 	bool					mIsFullscreen;
 };
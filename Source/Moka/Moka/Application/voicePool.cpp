@@ -0,0 +1,136 @@
+#include "voicePool.h"
+#include "memoryTracker.h"
+
+#include <cassert>
+#include <stdexcept>
+
+
+namespace
+{
+	VoicePool	*instance = nullptr;
+}
+
+VoicePool & VoicePool::getInstance()
+{
+	assert(("The Application has not made its voice pool yet!", instance));
+	return *instance;
+}
+
+VoicePool::VoicePool()
+: mEffects()
+, mVoices()
+, mStartCount(0)
+, mRequested(false)
+{
+	for (Effect &effect : mEffects)
+	{
+		effect.priority = Priority::Normal;
+		effect.loaded = false;
+		effect.requested = false;
+	}
+
+	for (Voice &voice : mVoices)
+	{
+		voice.priority = Priority::Low;
+		voice.started = 0;
+	}
+
+	assert(("There can only be one voice pool!", !instance));
+	instance = this;
+}
+
+VoicePool::~VoicePool()
+{
+	instance = nullptr;
+}
+
+void VoicePool::load(SoundEffects::ID id, const std::string &filename, Priority priority)
+{
+	const std::size_t index = static_cast<std::size_t>(id);
+	assert(("The sound effect does not fit in the pool!", index < effectCount));
+
+	Effect &effect = mEffects[index];
+	if (!effect.buffer.loadFromFile(filename))
+	{
+		throw std::runtime_error("ALW - Runtime Error: Failed to load " + filename);
+	}
+
+	// ALW - SFML keeps the samples itself, so they never pass through operator new.
+	MemoryTracker::recordExternal(MemoryTracker::Sounds, effect.buffer.getSampleCount() * sizeof(sf::Int16));
+
+	effect.priority = priority;
+	effect.loaded = true;
+}
+
+void VoicePool::play(SoundEffects::ID id)
+{
+	Effect &effect = mEffects[static_cast<std::size_t>(id)];
+	assert(("The sound effect is not loaded!", effect.loaded));
+
+	effect.requested = true;
+	mRequested = true;
+}
+
+void VoicePool::update()
+{
+	if (!mRequested)
+		return;
+
+	// ALW - Higher priorities start first, so a lower one cannot take the voice they would have been given.
+	for (int priority = Priority::High; priority >= Priority::Low; --priority)
+	{
+		for (Effect &effect : mEffects)
+		{
+			if (effect.requested && effect.priority == priority)
+				start(effect);
+		}
+	}
+
+	mRequested = false;
+}
+
+void VoicePool::clearRequests()
+{
+	for (Effect &effect : mEffects)
+		effect.requested = false;
+
+	mRequested = false;
+}
+
+void VoicePool::start(Effect &effect)
+{
+	effect.requested = false;
+
+	Voice *voice = findVoice(effect.priority);
+	if (!voice)
+		return;
+
+	// ALW - sf::SoundBuffer keeps a set of the sounds using it, so the buffer is only set when it changes.
+	voice->sound.stop();
+	if (voice->sound.getBuffer() != &effect.buffer)
+		voice->sound.setBuffer(effect.buffer);
+
+	voice->priority = effect.priority;
+	voice->started = ++mStartCount;
+	voice->sound.play();
+}
+
+VoicePool::Voice * VoicePool::findVoice(Priority priority)
+{
+	Voice *oldest = nullptr;
+
+	for (Voice &voice : mVoices)
+	{
+		if (voice.sound.getStatus() == sf::Sound::Stopped)
+			return &voice;
+
+		if (voice.priority > priority)
+			continue;
+
+		if (!oldest || voice.priority < oldest->priority
+			|| (voice.priority == oldest->priority && voice.started < oldest->started))
+			oldest = &voice;
+	}
+
+	return oldest;
+}
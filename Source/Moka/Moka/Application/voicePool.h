@@ -0,0 +1,80 @@
+#ifndef VOICE_POOL_H
+#define VOICE_POOL_H
+
+#include "../Resources/resourceIdentifiers.h"
+
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <array>
+#include <string>
+
+
+// ALW - Plays the game's own sound effects on a fixed set of voices. trmb::SoundPlayer starts a new sf::Sound for
+// ALW - every request and keeps it in a list that has to be scanned for finished sounds, so rapid clicking or a
+// ALW - fast-forwarded night could pile up overlapping copies. Here a request only marks its effect, and update()
+// ALW - starts each marked effect once per frame. A finished voice is simply reused the next time a voice is
+// ALW - needed. When every voice is busy, the oldest voice of the lowest priority no higher than the request is
+// ALW - taken, and the request is dropped if there is none. Trambo's buttons still play through trmb::SoundPlayer.
+// ALW - The Application owns the pool, so its sounds and buffers are gone before SFML's audio device.
+class VoicePool
+{
+public:
+	enum Priority
+	{
+		Low		= 0,
+		Normal	= 1,
+		High	= 2,
+	};
+
+
+public:
+	// ALW - The Application's pool. trmb::StateStack makes the states from a context that has no room for it, so
+	// ALW - GameState finds it here and hands it to the World.
+	static VoicePool &		getInstance();
+
+							VoicePool();
+							VoicePool(const VoicePool &) = delete;
+	VoicePool &				operator=(const VoicePool &) = delete;
+							~VoicePool();
+
+	void					load(SoundEffects::ID id, const std::string &filename, Priority priority);
+
+	void					play(SoundEffects::ID id);	// ALW - Starts at the next update(), once however often it was asked
+	void					update();
+	void					clearRequests();
+
+
+private:
+	static const std::size_t	voiceCount = 8;
+	static const std::size_t	effectCount = static_cast<std::size_t>(SoundEffects::ID::Count);
+
+	struct Effect
+	{
+		sf::SoundBuffer		buffer;
+		Priority			priority;
+		bool				loaded;
+		bool				requested;
+	};
+
+	struct Voice
+	{
+		sf::Sound			sound;
+		Priority			priority;
+		unsigned long		started;	// ALW - Orders the voices by when they started
+	};
+
+
+private:
+	void					start(Effect &effect);
+	Voice *					findVoice(Priority priority);
+
+
+private:
+	std::array<Effect, effectCount>		mEffects;
+	std::array<Voice, voiceCount>		mVoices;
+	unsigned long						mStartCount;
+	bool								mRequested;
+};
+
+#endif
@@ -1,20 +1,24 @@
 #include "eventDialogManager.h"
 #include "didYouKnow.h"
+#include "../Application/voicePool.h"
 #include "../HUD/chatBoxUI.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Localize/localize.h"
-#include "Trambo/Sounds/soundPlayer.h"
 
+#include <functional>
 
-EventDialogManager::EventDialogManager(ChatBoxUI &chatBoxUI, DidYouKnow &didYouKnow, trmb::SoundPlayer &soundPlayer)
+
+EventDialogManager::EventDialogManager(ChatBoxUI &chatBoxUI, DidYouKnow &didYouKnow, EventScheduler &scheduler
+	, VoicePool &voicePool)
 : mSimulationDuration(sf::seconds(120))
 , mMinimumEventDialogs(3)
 , mChatBoxUI(chatBoxUI)
 , mDidYouKnow(didYouKnow)
-, mSoundPlayer(soundPlayer)
-, mTimer()
-, mPause(true)
+, mScheduler(scheduler)
+, mVoicePool(voicePool)
+, mIntervalEvent(EventScheduler::noEvent)
 , mIntervalDuration()
 , mTotalIntervals(0)
 , mIntervalCount(0)
@@ -33,6 +37,11 @@ void EventDialogManager::initialize(int totalScheduledEventDialogs)
 	mIntervalDuration = mSimulationDuration / static_cast<float>(mTotalIntervals);
 }
 
+sf::Time EventDialogManager::getSimulationDuration() const
+{
+	return mSimulationDuration;
+}
+
 bool EventDialogManager::isFinished() const
 {
 	return mFinished;
@@ -52,50 +61,54 @@ bool EventDialogManager::isReadyToDisplay()
 void EventDialogManager::displayText(std::string string)
 {
 	mChatBoxUI.updateText(string, true);
-	mSoundPlayer.play(SoundEffects::ID::Chat);
+	mVoicePool.play(SoundEffects::ID::Chat);
+
+	// ALW - The prompt only takes effect when the World sends its events, so stop the night here. A collision pass
+	// ALW - that shows a dialog is then the last thing simulated until the player clears it.
+	mScheduler.stop();
 }
 
 void EventDialogManager::start()
 {
-	mPause = false;
+	// ALW - Event dialogs are not displayed at the beginning of the first interval or then end of the last interval.
+	// ALW - If an asterisk represents the displaying of an event dialog and there 3 synchronous event dialogs then it 
+	// ALW - look like this. | interval 1 |* interval 2 |* interval 3 |* interval 4 |
+	if (!mFinished && !mScheduler.isPending(mIntervalEvent))
+		mIntervalEvent = mScheduler.schedule(mIntervalDuration, std::bind(&EventDialogManager::endInterval, this));
 }
 
-void EventDialogManager::stop()
+void EventDialogManager::save(Snapshot &snapshot) const
 {
-	mPause = true;
+	mScheduler.save(snapshot, mIntervalEvent);
+	snapshot.writeTime(mIntervalDuration);
+	snapshot.write(mTotalIntervals);
+	snapshot.write(mIntervalCount);
+	snapshot.write(mReadyToDisplay);
+	snapshot.write(mFinished);
 }
 
-void EventDialogManager::reset()
+void EventDialogManager::load(Snapshot &snapshot)
 {
-	mPause = true;
-	mTimer = sf::Time::Zero;
+	mIntervalEvent = mScheduler.load(snapshot, mIntervalEvent, std::bind(&EventDialogManager::endInterval, this));
+	mIntervalDuration = snapshot.readTime();
+	snapshot.read(mTotalIntervals);
+	snapshot.read(mIntervalCount);
+	snapshot.read(mReadyToDisplay);
+	snapshot.read(mFinished);
 }
 
-void EventDialogManager::update(sf::Time dt)
+void EventDialogManager::endInterval()
 {
-	// ALW - Event dialogs are not displayed at the beginning of the first interval or then end of the last interval.
-	// ALW - If an asterisk represents the displaying of an event dialog and there 3 synchronous event dialogs then it 
-	// ALW - look like this. | interval 1 |* interval 2 |* interval 3 |* interval 4 |
-	if (!mPause && !mFinished)
+	++mIntervalCount;
+
+	if (mIntervalCount >= mTotalIntervals)
+	{
+		mReadyToDisplay = false;
+		mFinished = true;
+	}
+	else
 	{
-		mTimer += dt;
-
-		if (mIntervalCount < mTotalIntervals)
-		{
-			sf::Time startOfNextInterval = mIntervalDuration * static_cast<float>(mIntervalCount + 1);
-
-			if (startOfNextInterval <= mTimer)
-			{
-				++mIntervalCount;
-
-				if (mIntervalCount >= mTotalIntervals)
-				{
-					mReadyToDisplay = false;
-					mFinished = true;
-				}
-				else
-					mReadyToDisplay = true;
-			}
-		}
+		mReadyToDisplay = true;
+		mIntervalEvent = mScheduler.schedule(mIntervalDuration, std::bind(&EventDialogManager::endInterval, this));
 	}
 }
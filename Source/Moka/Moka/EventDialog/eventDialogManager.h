@@ -1,38 +1,42 @@
 #ifndef EVENT_DIALOG_MANAGER_H
 #define EVENT_DIALOG_MANAGER_H
 
+#include "../Simulation/eventScheduler.h"
+
 #include <SFML/System/Time.hpp>
 
 #include <string>
 
 
-namespace trmb
-{
-	class SoundPlayer;
-}
-
 class ChatBoxUI;
 class DidYouKnow;
+class Snapshot;
+class VoicePool;
 
 class EventDialogManager
 {
 public:
-								EventDialogManager(ChatBoxUI &chatBoxUI, DidYouKnow &didYouKnow, trmb::SoundPlayer &soundPlayer);
+								EventDialogManager(ChatBoxUI &chatBoxUI, DidYouKnow &didYouKnow, EventScheduler &scheduler
+									, VoicePool &voicePool);
 								EventDialogManager(const EventDialogManager &) = delete;
 	EventDialogManager &		operator=(const EventDialogManager &) = delete;
 
 	void						initialize(int totalScheduledEventDialogs);
 
+	sf::Time					getSimulationDuration() const;
 	bool						isFinished() const;
 	bool						isReadyToDisplay();
 
 	void						displayText(std::string string);
 
 	void						start();
-	void						stop();
-	void						reset();
 
-	void						update(sf::Time dt);
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
+
+private:
+	void						endInterval();
 
 
 private:
@@ -41,10 +45,10 @@ private:
 
 	ChatBoxUI					&mChatBoxUI;
 	DidYouKnow					&mDidYouKnow;
-	trmb::SoundPlayer			&mSoundPlayer;
+	EventScheduler				&mScheduler;
+	VoicePool					&mVoicePool;
 
-	sf::Time					mTimer;
-	bool						mPause;
+	EventScheduler::EventID		mIntervalEvent;		// ALW - The scheduler only advances while no prompt is active
 
 	sf::Time					mIntervalDuration;
 	int							mTotalIntervals;
@@ -0,0 +1,180 @@
+#include "flowField.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+
+const int FlowField::rollRange;
+const int FlowField::unreached;
+
+FlowField::FlowField(int tilesWide, int tilesHigh)
+: mTilesWide(tilesWide)
+, mTilesHigh(tilesHigh)
+, mDistances(tilesWide * tilesHigh, unreached)
+, mThresholds(tilesWide * tilesHigh)
+{
+	// ALW - Until it is built, every direction is equally likely.
+	for (std::array<int, Count> &thresholds : mThresholds)
+	{
+		for (int direction = 0; direction < Direction::Count; ++direction)
+			thresholds[direction] = rollRange * (direction + 1) / Direction::Count;
+	}
+}
+
+void FlowField::build(const InteractiveRegistry &registry, const std::vector<InteractiveRegistry::Prevention> &preventions)
+{
+	assert(("There must be a prevention for every entity!", preventions.size() == registry.getEntityCount()));
+
+	// ALW - A neighbor one tile closer to standing water or a home is half again as likely as each of the others.
+	const int closerWeight = 3;
+	const int otherWeight = 2;
+
+	std::fill(mDistances.begin(), mDistances.end(), unreached);
+	std::vector<int> frontier;
+
+	for (const InteractiveRegistry::Entity house : registry.getEntities(InteractiveRegistry::Kind::House))
+		addSource(registry.getCollisionBox(house), frontier);
+
+	for (const InteractiveRegistry::Entity barrel : registry.getEntities(InteractiveRegistry::Kind::Barrel))
+	{
+		if (!preventions[barrel].covered)
+			addSource(registry.getCollisionBox(barrel), frontier);
+	}
+
+	// ALW - The frontier is a queue that is never popped, so the tiles come out in order of distance.
+	for (std::size_t next = 0; next < frontier.size(); ++next)
+	{
+		const int tile = frontier[next];
+
+		for (int direction = 0; direction < Direction::Count; ++direction)
+		{
+			const int neighbor = getNeighborTile(tile, direction);
+			if (-1 == neighbor || unreached != mDistances[neighbor])
+				continue;
+
+			mDistances[neighbor] = mDistances[tile] + 1;
+			frontier.push_back(neighbor);
+		}
+	}
+
+	for (int tile = 0; tile < static_cast<int>(mThresholds.size()); ++tile)
+	{
+		std::array<int, Count> weights;
+		int totalWeight = 0;
+
+		for (int direction = 0; direction < Direction::Count; ++direction)
+		{
+			const int neighbor = getNeighborTile(tile, direction);
+			const bool closer = -1 != neighbor && unreached != mDistances[neighbor] && mDistances[neighbor] < mDistances[tile];
+
+			weights[direction] = closer ? closerWeight : otherWeight;
+			totalWeight += weights[direction];
+		}
+
+		int cumulativeWeight = 0;
+		for (int direction = 0; direction < Direction::Count; ++direction)
+		{
+			cumulativeWeight += weights[direction];
+			mThresholds[tile][direction] = rollRange * cumulativeWeight / totalWeight;
+		}
+	}
+}
+
+int FlowField::getDirection(sf::Vector2f position, int roll) const
+{
+	assert(("The roll is out of range!", 0 <= roll && roll < rollRange));
+
+	const int tile = getTile(position);
+	if (-1 == tile)
+		return roll * Direction::Count / rollRange;
+
+	const std::array<int, Count> &thresholds = mThresholds[tile];
+	int direction = 0;
+	while (thresholds[direction] <= roll)
+		++direction;
+
+	return direction;
+}
+
+float FlowField::getChance(sf::Vector2f position, int direction) const
+{
+	assert(("The direction is invalid", 0 <= direction && direction < Direction::Count));
+
+	const int tile = getTile(position);
+	if (-1 == tile)
+		return 1.0f / Direction::Count;
+
+	const int lower = 0 == direction ? 0 : mThresholds[tile][direction - 1];
+	return static_cast<float>(mThresholds[tile][direction] - lower) / rollRange;
+}
+
+void FlowField::addSource(sf::FloatRect collisionBox, std::vector<int> &frontier)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	// ALW - Every tile whose rect intersects the collision box, like the HouseTileMask.
+	const int firstColumn = std::max(0, static_cast<int>(std::floor(collisionBox.left / tileWidth)));
+	const int lastColumn = std::min(mTilesWide, static_cast<int>(std::ceil((collisionBox.left + collisionBox.width) / tileWidth)));
+	const int firstRow = std::max(0, static_cast<int>(std::floor(collisionBox.top / tileHeight)));
+	const int lastRow = std::min(mTilesHigh, static_cast<int>(std::ceil((collisionBox.top + collisionBox.height) / tileHeight)));
+
+	for (int row = firstRow; row < lastRow; ++row)
+	{
+		for (int column = firstColumn; column < lastColumn; ++column)
+		{
+			const int tile = row * mTilesWide + column;
+			if (unreached != mDistances[tile])
+				continue;
+
+			mDistances[tile] = 0;
+			frontier.push_back(tile);
+		}
+	}
+}
+
+int FlowField::getTile(sf::Vector2f position) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	const int column = static_cast<int>(std::floor(position.x / tileWidth));
+	const int row = static_cast<int>(std::floor(position.y / tileHeight));
+
+	if (column < 0 || mTilesWide <= column || row < 0 || mTilesHigh <= row)
+		return -1;
+
+	return row * mTilesWide + column;
+}
+
+int FlowField::getNeighborTile(int tile, int direction) const
+{
+	const int column = tile % mTilesWide;
+	const int row = tile / mTilesWide;
+	int neighbor = -1;
+
+	switch (direction)
+	{
+	case Direction::Up:
+		if (row > 0)
+			neighbor = tile - mTilesWide;
+		break;
+	case Direction::Down:
+		if (row < mTilesHigh - 1)
+			neighbor = tile + mTilesWide;
+		break;
+	case Direction::Left:
+		if (column > 0)
+			neighbor = tile - 1;
+		break;
+	case Direction::Right:
+		if (column < mTilesWide - 1)
+			neighbor = tile + 1;
+		break;
+	default:
+		assert(("The direction is invalid", false));
+	}
+
+	return neighbor;
+}
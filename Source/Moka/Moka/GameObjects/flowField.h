@@ -0,0 +1,64 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "interactiveRegistry.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <vector>
+
+
+// ALW - A per-tile table of movement odds that draws mosquitoes toward standing water and homes. A multi-source
+// ALW - breadth-first search from every house and uncovered barrel gives each tile its distance in tiles, and a
+// ALW - neighbor one tile closer is more likely to be picked than the others. Each tile keeps its four directions
+// ALW - as cumulative thresholds out of rollRange, so a move costs one dice roll and at most four compares. Build
+// ALW - it again whenever a barrel is covered or uncovered.
+class FlowField
+{
+public:
+	// ALW - Matches the Direction enums of MosquitoNode, NightSimulation, and the CompartmentalModel.
+	enum Direction
+	{
+		Up    = 0,
+		Down  = 1,
+		Left  = 2,
+		Right = 3,
+		Count
+	};
+
+
+public:
+	static const int		rollRange = 256;
+
+
+public:
+							FlowField(int tilesWide, int tilesHigh);
+							FlowField(const FlowField &) = delete;
+	FlowField &				operator=(const FlowField &) = delete;
+
+	void					build(const InteractiveRegistry &registry, const std::vector<InteractiveRegistry::Prevention> &preventions);
+
+	int						getDirection(sf::Vector2f position, int roll) const;	// ALW - roll is in [0, rollRange)
+	float					getChance(sf::Vector2f position, int direction) const;
+
+
+private:
+	void					addSource(sf::FloatRect collisionBox, std::vector<int> &frontier);
+	int						getTile(sf::Vector2f position) const;
+	int						getNeighborTile(int tile, int direction) const;
+
+
+private:
+	static const int		unreached = -1;
+
+
+private:
+	const int								mTilesWide;
+	const int								mTilesHigh;
+	std::vector<int>						mDistances;		// ALW - Tiles to the nearest house or uncovered barrel
+	std::vector<std::array<int, Count>>		mThresholds;
+};
+
+#endif
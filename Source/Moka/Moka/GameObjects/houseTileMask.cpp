@@ -0,0 +1,73 @@
+#include "houseTileMask.h"
+#include "interactiveGroup.h"
+#include "interactiveObject.h"
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <cassert>
+#include <cmath>
+
+
+const int HouseTileMask::noHouse;
+
+HouseTileMask::HouseTileMask(const InteractiveGroup &interactiveGroup)
+: mTilesWide(interactiveGroup.getWidth())
+, mTilesHigh(interactiveGroup.getHeight())
+, mHouseIDs(mTilesWide * mTilesHigh, noHouse)
+{
+	build(interactiveGroup);
+}
+
+bool HouseTileMask::isIndoor(sf::Vector2f position) const
+{
+	return noHouse != getHouseID(position);
+}
+
+int HouseTileMask::getHouseID(sf::Vector2f position) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	// ALW - Positions are tile aligned, so the tile under the top left corner is the only tile the position covers.
+	const int column = static_cast<int>(std::floor(position.x / tileWidth));
+	const int row = static_cast<int>(std::floor(position.y / tileHeight));
+
+	if (column < 0 || mTilesWide <= column || row < 0 || mTilesHigh <= row)
+		return noHouse;
+
+	return mHouseIDs[row * mTilesWide + column];
+}
+
+void HouseTileMask::build(const InteractiveGroup &interactiveGroup)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	int houseID = 0;
+
+	for (const InteractiveObject &interactiveObj : interactiveGroup.getInteractiveObjects())
+	{
+		if (interactiveObj.getType() != "House")
+			continue;
+
+		const sf::FloatRect collisionBox(interactiveObj.getCollisionBoxXCoord(), interactiveObj.getCollisionBoxYCoord()
+			, interactiveObj.getCollisionBoxWidth(), interactiveObj.getCollisionBoxHeight());
+
+		// ALW - Mark every tile whose rect intersects the collision box. This matches the result of the
+		// ALW - scene collision check between a mosquito's bounding rect and the house's bounding rect.
+		for (int row = 0; row < mTilesHigh; ++row)
+		{
+			for (int column = 0; column < mTilesWide; ++column)
+			{
+				const sf::FloatRect tileRect(column * tileWidth, row * tileHeight, tileWidth, tileHeight);
+
+				if (tileRect.intersects(collisionBox))
+				{
+					assert(("ALW - Logic Error: Two houses overlap the same tile!", noHouse == mHouseIDs[row * mTilesWide + column]));
+					mHouseIDs[row * mTilesWide + column] = houseID;
+				}
+			}
+		}
+
+		++houseID;
+	}
+}
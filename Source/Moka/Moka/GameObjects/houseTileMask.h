@@ -0,0 +1,38 @@
+#ifndef HOUSE_TILE_MASK_H
+#define HOUSE_TILE_MASK_H
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+
+class InteractiveGroup;
+
+// ALW - A per-tile grid of house IDs built once from the houses' collision boxes. A house ID is the
+// ALW - order the house appears in the Interactive objectgroup. Tiles outside of every house hold noHouse.
+class HouseTileMask
+{
+public:
+	explicit				HouseTileMask(const InteractiveGroup &interactiveGroup);
+							HouseTileMask(const HouseTileMask &) = delete;
+	HouseTileMask &			operator=(const HouseTileMask &) = delete;
+
+	bool					isIndoor(sf::Vector2f position) const;
+	int						getHouseID(sf::Vector2f position) const;
+
+
+public:
+	static const int		noHouse = -1;
+
+
+private:
+	void					build(const InteractiveGroup &interactiveGroup);
+
+
+private:
+	int						mTilesWide;
+	int						mTilesHigh;
+	std::vector<int>		mHouseIDs;
+};
+
+#endif
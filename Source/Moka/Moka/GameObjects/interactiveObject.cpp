@@ -115,27 +115,27 @@ float InteractiveObject::getCollisionBoxHeight() const
 	return mCollisionBoxHeight;
 }
 
-std::string InteractiveObject::getName() const
+const std::string & InteractiveObject::getName() const
 {
 	return mName;
 }
 
-std::string InteractiveObject::getType() const
+const std::string & InteractiveObject::getType() const
 {
 	return mType;
 }
 
-std::string InteractiveObject::getAttachedTo() const
+const std::string & InteractiveObject::getAttachedTo() const
 {
 	return mAttachedTo;
 }
 
-std::string InteractiveObject::getColor() const
+const std::string & InteractiveObject::getColor() const
 {
 	return mColor;
 }
 
-std::string InteractiveObject::getStyle() const
+const std::string & InteractiveObject::getStyle() const
 {
 	return mStyle;
 }
@@ -34,11 +34,11 @@ public:
 	float               getCollisionBoxWidth() const;
 	float               getCollisionBoxHeight() const;
 
-	std::string		    getName() const;
-	std::string		    getType() const;
-	std::string		    getAttachedTo() const;
-	std::string		    getColor() const;
-	std::string		    getStyle() const;
+	const std::string &	getName() const;
+	const std::string &	getType() const;
+	const std::string &	getAttachedTo() const;
+	const std::string &	getColor() const;
+	const std::string &	getStyle() const;
 
 
 private:
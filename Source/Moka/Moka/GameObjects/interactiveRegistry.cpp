@@ -0,0 +1,306 @@
+#include "interactiveRegistry.h"
+#include "interactiveGroup.h"
+#include "interactiveObject.h"
+#include "sceneTemplate.h"
+#include "../Simulation/snapshot.h"
+
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+const InteractiveRegistry::Entity InteractiveRegistry::noEntity = std::numeric_limits<InteractiveRegistry::Entity>::max();
+
+InteractiveRegistry::InteractiveRegistry(const InteractiveGroup &interactiveGroup)
+: mKinds()
+, mTransforms()
+, mBounds()
+, mCollisionBoxes()
+, mAttachedHouses()
+, mPreventions()
+, mBednets()
+, mResidents()
+, mTrackers()
+, mEntitiesByKind()
+, mPlanRevision(0)
+{
+	build(interactiveGroup);
+}
+
+InteractiveRegistry::InteractiveRegistry(const SceneTemplate &sceneTemplate)
+: mKinds(sceneTemplate.getRegistry().mKinds)
+, mTransforms(sceneTemplate.getRegistry().mTransforms)
+, mBounds(sceneTemplate.getRegistry().mBounds)
+, mCollisionBoxes(sceneTemplate.getRegistry().mCollisionBoxes)
+, mAttachedHouses(sceneTemplate.getRegistry().mAttachedHouses)
+, mPreventions(sceneTemplate.getRegistry().mPreventions)
+, mBednets(sceneTemplate.getRegistry().mBednets)
+, mResidents(sceneTemplate.getRegistry().mResidents)
+, mTrackers(sceneTemplate.getRegistry().mTrackers)
+, mEntitiesByKind(sceneTemplate.getRegistry().mEntitiesByKind)
+, mPlanRevision(0)
+{
+}
+
+std::size_t InteractiveRegistry::getEntityCount() const
+{
+	return mKinds.size();
+}
+
+const std::vector<InteractiveRegistry::Entity> &InteractiveRegistry::getEntities(Kind kind) const
+{
+	return mEntitiesByKind[static_cast<std::size_t>(kind)];
+}
+
+InteractiveRegistry::Kind InteractiveRegistry::getKind(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mKinds.size()));
+	return mKinds[entity];
+}
+
+sf::Vector2f InteractiveRegistry::getTransform(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mTransforms.size()));
+	return mTransforms[entity];
+}
+
+sf::FloatRect InteractiveRegistry::getBounds(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mBounds.size()));
+	return mBounds[entity];
+}
+
+sf::FloatRect InteractiveRegistry::getCollisionBox(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mCollisionBoxes.size()));
+	return mCollisionBoxes[entity];
+}
+
+InteractiveRegistry::Entity InteractiveRegistry::getAttachedHouse(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mAttachedHouses.size()));
+	return mAttachedHouses[entity];
+}
+
+const InteractiveRegistry::Prevention &InteractiveRegistry::getPrevention(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mPreventions.size()));
+	return mPreventions[entity];
+}
+
+const InteractiveRegistry::Bednets &InteractiveRegistry::getBednets(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mBednets.size()));
+	return mBednets[entity];
+}
+
+const InteractiveRegistry::Residents &InteractiveRegistry::getResidents(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mResidents.size()));
+	return mResidents[entity];
+}
+
+const InteractiveRegistry::Tracker &InteractiveRegistry::getTracker(Entity entity) const
+{
+	assert(("The entity is out of range!", entity < mTrackers.size()));
+	return mTrackers[entity];
+}
+
+std::size_t InteractiveRegistry::getPlanRevision() const
+{
+	return mPlanRevision;
+}
+
+void InteractiveRegistry::setCovered(Entity entity, bool isCovered)
+{
+	assert(("Only barrels can be covered!", Kind::Barrel == getKind(entity)));
+	mPreventions[entity].covered = isCovered;
+	++mPlanRevision;
+}
+
+void InteractiveRegistry::setClosed(Entity entity, bool isClosed)
+{
+	assert(("Only doors and windows can be closed!", Kind::Door == getKind(entity) || Kind::Window == getKind(entity)));
+	mPreventions[entity].closed = isClosed;
+	++mPlanRevision;
+}
+
+void InteractiveRegistry::setScreened(Entity entity, bool isScreened)
+{
+	assert(("Only windows can be screened!", Kind::Window == getKind(entity)));
+	mPreventions[entity].screened = isScreened;
+	++mPlanRevision;
+}
+
+void InteractiveRegistry::setBednets(Entity entity, int totalMintNets, int totalDamagedNets)
+{
+	assert(("Only houses have bednets!", Kind::House == getKind(entity)));
+	mBednets[entity].mint = totalMintNets;
+	mBednets[entity].damaged = totalDamagedNets;
+	++mPlanRevision;
+}
+
+void InteractiveRegistry::addInfectedResident(Entity entity)
+{
+	assert(("Only houses have residents!", Kind::House == getKind(entity)));
+	assert(("Every resident is already infected!", mResidents[entity].infected < mResidents[entity].total));
+	++mResidents[entity].infected;
+}
+
+void InteractiveRegistry::addIndoorMosquito(Entity entity, bool isInfected)
+{
+	assert(("Only houses track mosquitoes!", Kind::House == getKind(entity)));
+	Tracker &tracker = mTrackers[entity];
+	++tracker.mosquitoTotal;
+
+	if (isInfected)
+		++tracker.infectedMosquitoes;
+
+	tracker.dirty = true;
+}
+
+void InteractiveRegistry::removeIndoorMosquito(Entity entity, bool isInfected)
+{
+	assert(("Only houses track mosquitoes!", Kind::House == getKind(entity)));
+	Tracker &tracker = mTrackers[entity];
+	--tracker.mosquitoTotal;
+
+	if (isInfected)
+		--tracker.infectedMosquitoes;
+
+	tracker.dirty = true;
+}
+
+void InteractiveRegistry::addInfectedIndoorMosquito(Entity entity)
+{
+	assert(("Only houses track mosquitoes!", Kind::House == getKind(entity)));
+	++mTrackers[entity].infectedMosquitoes;
+	mTrackers[entity].dirty = true;
+}
+
+void InteractiveRegistry::setTracker(Entity entity, int mosquitoTotal, int infectedMosquitoes)
+{
+	assert(("Only houses track mosquitoes!", Kind::House == getKind(entity)));
+	Tracker &tracker = mTrackers[entity];
+
+	if (tracker.mosquitoTotal != mosquitoTotal || tracker.infectedMosquitoes != infectedMosquitoes)
+	{
+		tracker.mosquitoTotal = mosquitoTotal;
+		tracker.infectedMosquitoes = infectedMosquitoes;
+		tracker.dirty = true;
+	}
+}
+
+void InteractiveRegistry::clearTrackerDirty(Entity entity)
+{
+	assert(("The entity is out of range!", entity < mTrackers.size()));
+	mTrackers[entity].dirty = false;
+}
+
+void InteractiveRegistry::save(Snapshot &snapshot) const
+{
+	snapshot.write(getEntityCount());
+
+	// ALW - Only the components that change during a session are saved. The rest come from the map.
+	for (Entity entity = 0; entity < getEntityCount(); ++entity)
+	{
+		snapshot.write(mPreventions[entity]);
+		snapshot.write(mBednets[entity]);
+		snapshot.write(mResidents[entity]);
+		snapshot.write(mTrackers[entity]);
+	}
+}
+
+void InteractiveRegistry::load(Snapshot &snapshot)
+{
+	std::size_t entityCount = 0;
+	snapshot.read(entityCount);
+
+	if (entityCount != getEntityCount())
+		throw std::runtime_error("ALW - Runtime Error: The snapshot was taken on a different map.");
+
+	for (Entity entity = 0; entity < entityCount; ++entity)
+	{
+		snapshot.read(mPreventions[entity]);
+		snapshot.read(mBednets[entity]);
+		snapshot.read(mResidents[entity]);
+		snapshot.read(mTrackers[entity]);
+
+		// ALW - Push every tracker to its HouseTrackerUI on the next update.
+		mTrackers[entity].dirty = true;
+	}
+
+	++mPlanRevision;
+}
+
+void InteractiveRegistry::build(const InteractiveGroup &interactiveGroup)
+{
+	const std::vector<InteractiveObject> &interactiveObjects = interactiveGroup.getInteractiveObjects();
+	const std::size_t entityCount = interactiveObjects.size();
+
+	mKinds.reserve(entityCount);
+	mTransforms.reserve(entityCount);
+	mBounds.reserve(entityCount);
+	mCollisionBoxes.reserve(entityCount);
+	mAttachedHouses.reserve(entityCount);
+	mPreventions.reserve(entityCount);
+	mBednets.reserve(entityCount);
+	mResidents.reserve(entityCount);
+	mTrackers.reserve(entityCount);
+
+	for (Entity entity = 0; entity < entityCount; ++entity)
+	{
+		const InteractiveObject &interactiveObj = interactiveObjects[entity];
+		const std::string &type = interactiveObj.getType();
+
+		Kind kind = Kind::Other;
+		if ("Barrel" == type)
+			kind = Kind::Barrel;
+		else if ("Clinic" == type)
+			kind = Kind::Clinic;
+		else if ("Door" == type)
+			kind = Kind::Door;
+		else if ("House" == type)
+			kind = Kind::House;
+		else if ("Window" == type)
+			kind = Kind::Window;
+
+		const Prevention prevention = { false, false, false };
+		const Bednets bednets = { 0, Kind::House == kind ? interactiveObj.getNets() : 0 };
+		const Residents residents = { Kind::House == kind ? interactiveObj.getResidents() : 0, 0 };
+		const Tracker tracker = { 0, 0, false };
+
+		mKinds.push_back(kind);
+		mTransforms.emplace_back(sf::Vector2f(interactiveObj.getX(), interactiveObj.getY()));
+		mBounds.emplace_back(sf::FloatRect(interactiveObj.getX(), interactiveObj.getY(), interactiveObj.getWidth()
+			, interactiveObj.getHeight()));
+		mCollisionBoxes.emplace_back(sf::FloatRect(interactiveObj.getCollisionBoxXCoord(), interactiveObj.getCollisionBoxYCoord()
+			, interactiveObj.getCollisionBoxWidth(), interactiveObj.getCollisionBoxHeight()));
+		mAttachedHouses.push_back(noEntity);
+		mPreventions.push_back(prevention);
+		mBednets.push_back(bednets);
+		mResidents.push_back(residents);
+		mTrackers.push_back(tracker);
+		mEntitiesByKind[static_cast<std::size_t>(kind)].push_back(entity);
+	}
+
+	// ALW - Resolve the attachedTo property once, so a mosquito passing through a door or window finds its
+	// ALW - house with an index instead of a map lookup.
+	for (Entity entity = 0; entity < entityCount; ++entity)
+	{
+		if (Kind::Door != mKinds[entity] && Kind::Window != mKinds[entity])
+			continue;
+
+		for (const Entity house : getEntities(Kind::House))
+		{
+			if (interactiveObjects[house].getName() == interactiveObjects[entity].getAttachedTo())
+			{
+				mAttachedHouses[entity] = house;
+				break;
+			}
+		}
+
+		assert(("The door or window is not attached to a house!", noEntity != mAttachedHouses[entity]));
+	}
+}
@@ -0,0 +1,120 @@
+#ifndef INTERACTIVE_REGISTRY_H
+#define INTERACTIVE_REGISTRY_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+
+class InteractiveGroup;
+class SceneTemplate;
+class Snapshot;
+
+// ALW - Dense component arrays for the objects in the Interactive objectgroup. An entity is the index of its
+// ALW - InteractiveObject, so houses, doors, windows, and barrels keep the order the rest of the game already
+// ALW - uses. The *Node classes write their state here and the InteriorBatch and World read it back,
+// ALW - instead of broadcasting sprite events and looking each other up through maps.
+class InteractiveRegistry
+{
+public:
+	typedef std::size_t			Entity;
+
+	enum class Kind
+	{
+		Barrel,
+		Clinic,
+		Door,
+		House,
+		Window,
+		Other,
+		Count
+	};
+
+	struct Prevention
+	{
+		bool					covered;
+		bool					closed;
+		bool					screened;
+	};
+
+	struct Bednets
+	{
+		int						mint;
+		int						damaged;
+	};
+
+	struct Residents
+	{
+		int						total;
+		int						infected;
+	};
+
+	struct Tracker
+	{
+		int						mosquitoTotal;
+		int						infectedMosquitoes;
+		bool					dirty;			// ALW - Changed since the HouseTrackerUI was last updated
+	};
+
+
+public:
+	static const Entity			noEntity;
+
+
+public:
+	explicit					InteractiveRegistry(const InteractiveGroup &interactiveGroup);
+	explicit					InteractiveRegistry(const SceneTemplate &sceneTemplate);	// ALW - Clones the template's registry
+								InteractiveRegistry(const InteractiveRegistry &) = delete;
+	InteractiveRegistry &		operator=(const InteractiveRegistry &) = delete;
+
+	std::size_t					getEntityCount() const;
+	const std::vector<Entity> &	getEntities(Kind kind) const;
+	Kind						getKind(Entity entity) const;
+	sf::Vector2f				getTransform(Entity entity) const;
+	sf::FloatRect				getBounds(Entity entity) const;			// ALW - The rect the player clicks on
+	sf::FloatRect				getCollisionBox(Entity entity) const;
+	Entity						getAttachedHouse(Entity entity) const;
+	const Prevention &			getPrevention(Entity entity) const;
+	const Bednets &				getBednets(Entity entity) const;
+	const Residents &			getResidents(Entity entity) const;
+	const Tracker &				getTracker(Entity entity) const;
+	std::size_t					getPlanRevision() const;				// ALW - Changes whenever a prevention or the bednets change
+
+	void						setCovered(Entity entity, bool isCovered);
+	void						setClosed(Entity entity, bool isClosed);
+	void						setScreened(Entity entity, bool isScreened);
+	void						setBednets(Entity entity, int totalMintNets, int totalDamagedNets);
+	void						addInfectedResident(Entity entity);
+
+	void						addIndoorMosquito(Entity entity, bool isInfected);
+	void						removeIndoorMosquito(Entity entity, bool isInfected);
+	void						addInfectedIndoorMosquito(Entity entity);
+	void						setTracker(Entity entity, int mosquitoTotal, int infectedMosquitoes);
+	void						clearTrackerDirty(Entity entity);
+
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
+
+private:
+	void						build(const InteractiveGroup &interactiveGroup);
+
+
+private:
+	std::vector<Kind>											mKinds;
+	std::vector<sf::Vector2f>									mTransforms;
+	std::vector<sf::FloatRect>									mBounds;
+	std::vector<sf::FloatRect>									mCollisionBoxes;
+	std::vector<Entity>											mAttachedHouses;
+	std::vector<Prevention>										mPreventions;
+	std::vector<Bednets>										mBednets;
+	std::vector<Residents>										mResidents;
+	std::vector<Tracker>										mTrackers;
+	std::array<std::vector<Entity>, static_cast<std::size_t>(Kind::Count)>	mEntitiesByKind;
+	std::size_t													mPlanRevision;
+};
+
+#endif
@@ -1,11 +1,16 @@
 #include "objectGroups.h"
+#include "../Application/memoryTracker.h"
 
 #include <cassert>
+#include <cstring>
 #include <vector>
 #include <stdexcept>
 
 
 ObjectGroups::ObjectGroups(const std::string &filename)
+: mInteractiveGroup()
+, mMosquitoCount(500)
+, mAggregateMode(false)
 {
 	read(filename);
 }
@@ -15,10 +20,22 @@ const InteractiveGroup & ObjectGroups::getInteractiveGroup() const
 	return mInteractiveGroup;
 }
 
+int ObjectGroups::getMosquitoCount() const
+{
+	return mMosquitoCount;
+}
+
+bool ObjectGroups::isAggregateMode() const
+{
+	return mAggregateMode;
+}
+
 void ObjectGroups::read(const std::string &filename)
 {
+	MemoryTracker::Scope scope(MemoryTracker::Map);
 	tinyxml2::XMLDocument config;
 	loadFile(filename, config);
+	readMapProperties(config);
 	readInteractiveGroup(config);
 }
 
@@ -32,6 +49,44 @@ void ObjectGroups::loadFile(const std::string &filename, tinyxml2::XMLDocument &
 	}
 }
 
+void ObjectGroups::readMapProperties(tinyxml2::XMLDocument &config)
+{
+	tinyxml2::XMLElement *element = config.FirstChildElement("map");
+	if (element == nullptr)
+	{
+		throw std::runtime_error("ALW - Runtime Error: Failed to read map element.");
+	}
+
+	// ALW - The map's own properties are optional. A map without them keeps the defaults.
+	element = element->FirstChildElement("properties");
+	if (element == nullptr)
+		return;
+
+	for (element = element->FirstChildElement("property"); element != nullptr; element = element->NextSiblingElement("property"))
+	{
+		const char *name = element->Attribute("name");
+		if (name == nullptr)
+		{
+			throw std::runtime_error("ALW - Runtime Error: A map property element has no name.");
+		}
+
+		if (std::strcmp(name, "MosquitoCount") == 0)
+		{
+			if (element->QueryIntAttribute("value", &mMosquitoCount) != tinyxml2::XML_NO_ERROR || mMosquitoCount < 0)
+			{
+				throw std::runtime_error("ALW - Runtime Error: Unable to convert MosquitoCount property.");
+			}
+		}
+		else if (std::strcmp(name, "AggregateMode") == 0)
+		{
+			if (element->QueryBoolAttribute("value", &mAggregateMode) != tinyxml2::XML_NO_ERROR)
+			{
+				throw std::runtime_error("ALW - Runtime Error: Unable to convert AggregateMode property.");
+			}
+		}
+	}
+}
+
 void ObjectGroups::readInteractiveGroup(tinyxml2::XMLDocument &config)
 {
 	tinyxml2::XMLElement *element = config.FirstChildElement("map");
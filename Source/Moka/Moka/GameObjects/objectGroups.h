@@ -16,11 +16,14 @@ public:
 	ObjectGroups &						operator=(const ObjectGroups &) = delete;
 
 	const InteractiveGroup &			getInteractiveGroup() const;
+	int									getMosquitoCount() const;
+	bool								isAggregateMode() const;
 
 
 private:
 	void								read(const std::string &filename);
 	void								loadFile(const std::string &filename, tinyxml2::XMLDocument &config);
+	void								readMapProperties(tinyxml2::XMLDocument &config);
 	void								readInteractiveGroup(tinyxml2::XMLDocument &config);
 	InteractiveObject                   readInteractiveObject(tinyxml2::XMLElement *element) const;
 
@@ -56,6 +59,8 @@ private:
 
 private:
 	InteractiveGroup					mInteractiveGroup;
+	int									mMosquitoCount;		// ALW - The night's starting mosquitoes
+	bool								mAggregateMode;		// ALW - Simulate the night with the CompartmentalModel
 };
 
 #endif
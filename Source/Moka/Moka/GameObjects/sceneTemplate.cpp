@@ -0,0 +1,19 @@
+#include "sceneTemplate.h"
+#include "interactiveGroup.h"
+
+
+SceneTemplate::SceneTemplate(const InteractiveGroup &interactiveGroup)
+: mRegistry(interactiveGroup)
+, mHouseTileMask(interactiveGroup)
+{
+}
+
+const InteractiveRegistry & SceneTemplate::getRegistry() const
+{
+	return mRegistry;
+}
+
+const HouseTileMask & SceneTemplate::getHouseTileMask() const
+{
+	return mHouseTileMask;
+}
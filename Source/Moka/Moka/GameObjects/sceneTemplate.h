@@ -0,0 +1,31 @@
+#ifndef SCENE_TEMPLATE_H
+#define SCENE_TEMPLATE_H
+
+#include "houseTileMask.h"
+#include "interactiveRegistry.h"
+
+
+class InteractiveGroup;
+
+// ALW - The part of a World that depends only on the map. It holds the registry as it stands before the player
+// ALW - touches anything, with every door and window already attached to its house, and the house tile mask.
+// ALW - It is built once per map and kept in the AssetCache, so a new game clones the registry and shares the
+// ALW - mask instead of comparing object names and rasterizing the houses again. Only patient zero and the
+// ALW - mosquito spawns are rolled per game.
+class SceneTemplate
+{
+public:
+	explicit					SceneTemplate(const InteractiveGroup &interactiveGroup);
+								SceneTemplate(const SceneTemplate &) = delete;
+	SceneTemplate &				operator=(const SceneTemplate &) = delete;
+
+	const InteractiveRegistry &	getRegistry() const;
+	const HouseTileMask &		getHouseTileMask() const;
+
+
+private:
+	InteractiveRegistry			mRegistry;
+	HouseTileMask				mHouseTileMask;
+};
+
+#endif
@@ -0,0 +1,146 @@
+#include "spawnSampler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
+
+sf::Vector2f SpawnSampler::clamp(sf::Vector2f position, sf::FloatRect worldBounds)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	position.x = std::max(worldBounds.left, std::min(worldBounds.left + worldBounds.width - tileWidth, position.x));
+	position.y = std::max(worldBounds.top, std::min(worldBounds.top + worldBounds.height - tileHeight, position.y));
+
+	return position;
+}
+
+SpawnSampler::SpawnSampler(int tilesWide, int tilesHigh)
+: mTilesWide(tilesWide)
+, mTilesHigh(tilesHigh)
+, mChances(tilesWide * tilesHigh, 1.0f / (tilesWide * tilesHigh))
+, mKeepChances(tilesWide * tilesHigh, 1.0f)
+, mAliases(tilesWide * tilesHigh)
+{
+	assert(("The map has no tiles!", !mChances.empty()));
+
+	// ALW - Until it is built, every tile is equally likely.
+	std::iota(mAliases.begin(), mAliases.end(), 0);
+}
+
+void SpawnSampler::build(const InteractiveRegistry &registry, const std::vector<InteractiveRegistry::Prevention> &preventions)
+{
+	assert(("There must be a prevention for every entity!", preventions.size() == registry.getEntityCount()));
+
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	const float tileWeight = 1.0f;
+	const float coveredBarrelWeight = 1.0f;		// ALW - Rain still pools around a covered barrel
+	const float uncoveredBarrelWeight = 4.0f;
+	const int tileCount = static_cast<int>(mChances.size());
+
+	// ALW - A barrel adds weight to its own tile and the eight tiles around it.
+	std::vector<float> weights(tileCount, tileWeight);
+	for (const InteractiveRegistry::Entity barrel : registry.getEntities(InteractiveRegistry::Kind::Barrel))
+	{
+		const sf::FloatRect collisionBox = registry.getCollisionBox(barrel);
+		const int barrelColumn = static_cast<int>(std::floor(collisionBox.left / tileWidth));
+		const int barrelRow = static_cast<int>(std::floor(collisionBox.top / tileHeight));
+		const float weight = preventions[barrel].covered ? coveredBarrelWeight : uncoveredBarrelWeight;
+
+		for (int row = std::max(0, barrelRow - 1); row <= std::min(mTilesHigh - 1, barrelRow + 1); ++row)
+		{
+			for (int column = std::max(0, barrelColumn - 1); column <= std::min(mTilesWide - 1, barrelColumn + 1); ++column)
+				weights[row * mTilesWide + column] += weight;
+		}
+	}
+
+	const float totalWeight = std::accumulate(weights.begin(), weights.end(), 0.0f);
+	for (int tile = 0; tile < tileCount; ++tile)
+		mChances[tile] = weights[tile] / totalWeight;
+
+	// ALW - Vose's alias method. Each column holds one tile's share scaled so the average is 1. A column under 1 is
+	// ALW - topped up with the excess of a column over 1, which becomes its alias.
+	std::vector<float> scaled(tileCount);
+	std::vector<int> small;
+	std::vector<int> large;
+
+	for (int tile = 0; tile < tileCount; ++tile)
+	{
+		scaled[tile] = mChances[tile] * tileCount;
+		(scaled[tile] < 1.0f ? small : large).push_back(tile);
+	}
+
+	while (!small.empty() && !large.empty())
+	{
+		const int less = small.back();
+		small.pop_back();
+		const int more = large.back();
+		large.pop_back();
+
+		mKeepChances[less] = scaled[less];
+		mAliases[less] = more;
+
+		scaled[more] = (scaled[more] + scaled[less]) - 1.0f;
+		(scaled[more] < 1.0f ? small : large).push_back(more);
+	}
+
+	// ALW - Whatever is left is 1 up to rounding error.
+	for (const int tile : large)
+	{
+		mKeepChances[tile] = 1.0f;
+		mAliases[tile] = tile;
+	}
+
+	for (const int tile : small)
+	{
+		mKeepChances[tile] = 1.0f;
+		mAliases[tile] = tile;
+	}
+}
+
+float SpawnSampler::getChance(sf::Vector2f position) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	const int column = static_cast<int>(std::floor(position.x / tileWidth));
+	const int row = static_cast<int>(std::floor(position.y / tileHeight));
+
+	if (column < 0 || mTilesWide <= column || row < 0 || mTilesHigh <= row)
+		return 0.0f;
+
+	return mChances[row * mTilesWide + column];
+}
+
+sf::Vector2f SpawnSampler::sample(std::mt19937 &generator) const
+{
+	const int column = std::uniform_int_distribution<int>(0, static_cast<int>(mAliases.size()) - 1)(generator);
+	const bool keep = std::uniform_real_distribution<float>(0.0f, 1.0f)(generator) < mKeepChances[column];
+
+	return getPosition(keep ? column : mAliases[column]);
+}
+
+void SpawnSampler::sample(std::size_t count, std::mt19937 &generator, std::vector<sf::Vector2f> &positions) const
+{
+	std::uniform_int_distribution<int> columnDistribution(0, static_cast<int>(mAliases.size()) - 1);
+	std::uniform_real_distribution<float> coinDistribution(0.0f, 1.0f);
+	positions.reserve(positions.size() + count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const int column = columnDistribution(generator);
+		const bool keep = coinDistribution(generator) < mKeepChances[column];
+		positions.push_back(getPosition(keep ? column : mAliases[column]));
+	}
+}
+
+sf::Vector2f SpawnSampler::getPosition(int tile) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	return sf::Vector2f((tile % mTilesWide) * tileWidth, (tile / mTilesWide) * tileHeight);
+}
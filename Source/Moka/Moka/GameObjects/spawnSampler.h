@@ -0,0 +1,50 @@
+#ifndef SPAWN_SAMPLER_H
+#define SPAWN_SAMPLER_H
+
+#include "interactiveRegistry.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+
+// ALW - Picks the tile a mosquito swarm starts on. Every tile has a base weight, and the tiles around a barrel
+// ALW - weigh more, most of all when the barrel is uncovered. The weights are turned into Walker's alias table, so
+// ALW - a sample is one column roll and one coin flip no matter how big the map is. Build it again whenever a
+// ALW - barrel is covered or uncovered.
+class SpawnSampler
+{
+public:
+	// ALW - Moves a position that is off the map onto the nearest tile.
+	static sf::Vector2f			clamp(sf::Vector2f position, sf::FloatRect worldBounds);
+
+
+public:
+								SpawnSampler(int tilesWide, int tilesHigh);
+								SpawnSampler(const SpawnSampler &) = delete;
+	SpawnSampler &				operator=(const SpawnSampler &) = delete;
+
+	void						build(const InteractiveRegistry &registry, const std::vector<InteractiveRegistry::Prevention> &preventions);
+
+	float						getChance(sf::Vector2f position) const;		// ALW - Chance a sample lands on the position's tile
+
+	sf::Vector2f				sample(std::mt19937 &generator) const;
+	void						sample(std::size_t count, std::mt19937 &generator, std::vector<sf::Vector2f> &positions) const;
+
+
+private:
+	sf::Vector2f				getPosition(int tile) const;
+
+
+private:
+	const int					mTilesWide;
+	const int					mTilesHigh;
+	std::vector<float>			mChances;
+	std::vector<float>			mKeepChances;		// ALW - Chance a column keeps its own tile instead of its alias
+	std::vector<int>			mAliases;
+};
+
+#endif
@@ -1,4 +1,7 @@
 #include "chatBoxUI.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/eventQueue.h"
+#include "../Application/voicePool.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/undoUI.h"
 #include "../HUD/uiBundle.h"
@@ -7,7 +10,6 @@
 #include "Trambo/Camera/camera.h"
 #include "Trambo/Events/event.h"
 #include "Trambo/Localize/localize.h"
-#include "Trambo/Sounds/soundPlayer.h"
 #include "Trambo/Utilities/utility.h"
 
 #include <SFML/Graphics/Rect.hpp>
@@ -23,21 +25,15 @@
 
 
 ChatBoxUI::ChatBoxUI(const sf::RenderWindow &window, trmb::Camera &camera, Fonts::ID font, trmb::FontHolder &fonts
-	, SoundEffects::ID soundEffect, trmb::SoundPlayer &soundPlayer, UIBundle &uiBundle)
-: mCreateTextPrompt(0x25e87fd8)
-, mClearTextPrompt(0xc1523265)
-, mEnter(0xff349d1d)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mBeginScoreboardEvent(0xf5e88b6e)
-, mHorizontalSpacing(2.0f)
+	, SoundEffects::ID soundEffect, VoicePool &voicePool, UIBundle &uiBundle)
+: mHorizontalSpacing(2.0f)
 , mVerticalSpacing(15.0f)
 , mMaxLinesDrawn(5u)
 , mWindow(window)
 , mCamera(camera)
 , mFonts(fonts)
 , mSoundEffect(soundEffect)
-, mSoundPlayer(soundPlayer)
+, mVoicePool(voicePool)
 , mUIBundle(uiBundle)
 , mLinesToDraw(mMaxLinesDrawn)
 , mForceEndPrompt(false)
@@ -164,7 +160,7 @@ void ChatBoxUI::handler()
 
 void ChatBoxUI::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mEnter == gameEvent.getType())
+	if (Events::Enter == gameEvent.getType())
 	{
 		// ALW - There are three possibilities when an <Enter> is handled. There is an overflow of of text.
 		// ALW - More text will be displayed and the prompt will be cleared if there is not more text and
@@ -180,11 +176,11 @@ void ChatBoxUI::handleEvent(const trmb::Event &gameEvent)
 		}
 	}
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	else if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	else if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
-	else if (mBeginScoreboardEvent == gameEvent.getType())
+	else if (Events::BeginScoreboard == gameEvent.getType())
 	{
 		hide();
 	}
@@ -206,7 +202,7 @@ void ChatBoxUI::updateText(std::string string, bool forceEndPrompt)
 		assert(("Non-interupting messages do not force an end prompt and cannot be longer that the capacity of a chatbox!", !isOverFlow()));
 
 	if (isOverFlow() || mForceEndPrompt)
-		EventHandler::sendEvent(trmb::Event(mCreateTextPrompt));
+		EventQueue::getInstance().post(Events::CreateTextPrompt);
 }
 
 void ChatBoxUI::draw(sf::RenderTarget &target, sf::RenderStates states) const
@@ -323,9 +319,9 @@ void ChatBoxUI::displayMoreText()
 
 		setTextLinePosition();
 		calculateLinesToDraw();
-		mSoundPlayer.play(mSoundEffect);
+		mVoicePool.play(mSoundEffect);
 		if (!isOverFlow() && !mForceEndPrompt)
-			EventHandler::sendEvent(trmb::Event(mClearTextPrompt));
+			EventQueue::getInstance().post(Events::ClearTextPrompt);
 	}
 }
 
@@ -367,8 +363,8 @@ void ChatBoxUI::calculateLinesToDraw()
 void ChatBoxUI::clearPrompt()
 {
 	mForceEndPrompt = false;
-	mSoundPlayer.play(mSoundEffect);
-	EventHandler::sendEvent(trmb::Event(mClearTextPrompt));
+	mVoicePool.play(mSoundEffect);
+	EventQueue::getInstance().post(Events::ClearTextPrompt);
 }
 
 bool ChatBoxUI::isOverFlow() const
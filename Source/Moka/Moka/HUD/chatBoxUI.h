@@ -25,16 +25,16 @@ namespace trmb
 {
 	class Camera;
 	class Event;
-	class SoundPlayer;
 }
 
 class UIBundle;
+class VoicePool;
 
 class ChatBoxUI : public sf::Transformable, public sf::Drawable, public trmb::EventHandler
 {
 public:
 							ChatBoxUI(const sf::RenderWindow &window, trmb::Camera &camera, Fonts::ID font, trmb::FontHolder &fonts
-								, SoundEffects::ID soundEffect, trmb::SoundPlayer &soundPlayer, UIBundle &uiBundle);
+								, SoundEffects::ID soundEffect, VoicePool &voicePool, UIBundle &uiBundle);
 							ChatBoxUI(const ChatBoxUI &) = delete;
 	ChatBoxUI &				operator=(const ChatBoxUI &) = delete;
 
@@ -46,10 +46,6 @@ public:
 	void					updateText(std::string string, bool forceEndPrompt = false);
 
 
-private:
-	typedef					unsigned long EventGuid;
-
-	
 private:
 	virtual void			draw(sf::RenderTarget &target, sf::RenderStates states) const final;
 	void					enable();
@@ -75,13 +71,6 @@ private:
 
 
 private:
-	const EventGuid			mCreateTextPrompt;     // ALW - Is sent from here.
-	const EventGuid			mClearTextPrompt;      // ALW - Is sent from here.
-	const EventGuid			mEnter;                // ALW - Matches the GUID in the Controller class.
-	const EventGuid			mFullscreen;	       // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid			mWindowed;			   // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid			mBeginScoreboardEvent; // ALW - Matches the GUID in the World class.
-
 	const float				mHorizontalSpacing;
 	const float				mVerticalSpacing;
 	const unsigned int		mMaxLinesDrawn;
@@ -90,7 +79,7 @@ private:
 	trmb::Camera			&mCamera;
 	trmb::FontHolder		&mFonts;
 	SoundEffects::ID		mSoundEffect;
-	trmb::SoundPlayer		&mSoundPlayer;
+	VoicePool				&mVoicePool;
 	UIBundle				&mUIBundle;
 
 	sf::RectangleShape		mBackground;
@@ -0,0 +1,69 @@
+#include "countText.h"
+
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/System/String.hpp>
+
+
+namespace
+{
+	// ALW - The widest range of two ints, using every glyph a count can.
+	const char widestCount[] = "-0123456789 - -0123456789";
+
+	// ALW - Only the main thread draws, so one buffer serves every text. clear() keeps the capacity.
+	sf::String & getBuffer()
+	{
+		static sf::String buffer(widestCount);
+		return buffer;
+	}
+
+	void appendCount(sf::String &buffer, int count)
+	{
+		if (count < 0)
+		{
+			buffer += sf::String('-');
+			count = -count;
+		}
+
+		// ALW - Enough for the digits of any 32-bit int, written from the lowest digit up.
+		char digits[10];
+		int digitCount = 0;
+		do
+		{
+			digits[digitCount++] = static_cast<char>('0' + count % 10);
+			count /= 10;
+		} while (0 < count);
+
+		// ALW - A single character fits in sf::String's small buffer, so this does not allocate.
+		while (0 < digitCount)
+			buffer += sf::String(digits[--digitCount]);
+	}
+}
+
+void reserveCountText(sf::Text &text)
+{
+	const sf::String string = text.getString();
+	text.setString(widestCount);
+	text.setString(string);
+}
+
+void setCountText(sf::Text &text, int count)
+{
+	sf::String &buffer = getBuffer();
+	buffer.clear();
+	appendCount(buffer, count);
+
+	text.setString(buffer);
+}
+
+void setCountRangeText(sf::Text &text, int minCount, int maxCount)
+{
+	sf::String &buffer = getBuffer();
+	buffer.clear();
+	appendCount(buffer, minCount);
+	buffer += sf::String(' ');
+	buffer += sf::String('-');
+	buffer += sf::String(' ');
+	appendCount(buffer, maxCount);
+
+	text.setString(buffer);
+}
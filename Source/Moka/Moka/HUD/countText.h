@@ -0,0 +1,19 @@
+#ifndef COUNT_TEXT_H
+#define COUNT_TEXT_H
+
+namespace sf
+{
+	class Text;
+}
+
+// ALW - The trackers and the preview rewrite their numbers while the night runs. std::to_string() builds a
+// ALW - std::string and then an sf::String for every change. These write the digits a character at a time
+// ALW - into one reused sf::String instead, so once a text has held a number that long, setting it again does
+// ALW - not allocate. reserveCountText() makes that true from the start, by growing the text to the widest
+// ALW - count once and loading every glyph a count can use.
+
+void	reserveCountText(sf::Text &text);		// ALW - Call after the text's font and character size are set
+void	setCountText(sf::Text &text, int count);
+void	setCountRangeText(sf::Text &text, int minCount, int maxCount);	// ALW - "min - max"
+
+#endif
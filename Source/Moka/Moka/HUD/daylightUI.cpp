@@ -1,9 +1,12 @@
 #include "daylightUI.h"
+#include "../Application/eventIdentifiers.h"
 #include "chatBoxUI.h"
+#include "../Application/eventQueue.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/undoUI.h"
 #include "../HUD/uiBundle.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Camera/camera.h"
 #include "Trambo/Events/event.h"
@@ -24,12 +27,7 @@
 DaylightUI::DaylightUI(const sf::RenderWindow &window, trmb::Camera &camera, Fonts::ID font, trmb::FontHolder &fonts
 	, SoundEffects::ID soundEffect, trmb::SoundPlayer &soundPlayer, UIBundle &uiBundle, EventGuid leftClickPress
 	, EventGuid leftClickRelease)
-: mBeginSimulationEvent(0x5000e550)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mCreateTextPrompt(0x25e87fd8)
-, mClearTextPrompt(0xc1523265)
-, mMaxHours(12.0f)
+: mMaxHours(12.0f)
 , mMinHours(0.0f)
 , mFloatPrecision(3)
 , mWindow(window)
@@ -158,6 +156,20 @@ bool DaylightUI::subtract(float subtrahend)
 	return ret;
 }
 
+void DaylightUI::save(Snapshot &snapshot) const
+{
+	snapshot.write(mHourCount);
+}
+
+void DaylightUI::load(Snapshot &snapshot)
+{
+	snapshot.read(mHourCount);
+	assert(("ALW - Logic Error: The hour count is out of range!", mMinHours <= mHourCount && mMaxHours >= mHourCount));
+
+	mHoursText.setString(trmb::toStringWithPrecision(mHourCount, mFloatPrecision));
+	trmb::centerOrigin(mHoursText, true, true);
+}
+
 void DaylightUI::handler()
 {
 	mMouseOver = false;
@@ -232,15 +244,15 @@ void DaylightUI::handler()
 void DaylightUI::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
-	else if (mCreateTextPrompt == gameEvent.getType())
+	else if (Events::CreateTextPrompt == gameEvent.getType())
 	{
 		disable();
 	}
-	else if (mClearTextPrompt == gameEvent.getType())
+	else if (Events::ClearTextPrompt == gameEvent.getType())
 	{
 		enable();
 	}
@@ -298,7 +310,7 @@ void DaylightUI::repositionGUI()
 
 void DaylightUI::done()
 {
-	EventHandler::sendEvent(mBeginSimulationEvent);
+	EventQueue::getInstance().post(Events::BeginSimulation);
 	mUIBundle.getChatBoxUI().updateText(trmb::Localize::getInstance().getString("simulationGreeting"), true);
 	hide();
 }
@@ -30,6 +30,7 @@ namespace trmb
 	class SoundPlayer;
 }
 
+class Snapshot;
 class UIBundle;
 
 class DaylightUI : public sf::Transformable, public sf::Drawable, public trmb::EventHandler
@@ -54,6 +55,9 @@ public:
 	void				    add(float addend);
 	bool				    subtract(float subtrahend);
 
+	void				    save(Snapshot &snapshot) const;
+	void				    load(Snapshot &snapshot);
+
 	void			        done();
 
 
@@ -70,12 +74,6 @@ private:
 
 
 private:
-	const trmb::Event       mBeginSimulationEvent; // ALW - Is sent from here.
-	const EventGuid		    mFullscreen;		   // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid		    mWindowed;		       // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid		    mCreateTextPrompt;     // ALW - Matches the GUID in the ChatBoxUI class.
-	const EventGuid		    mClearTextPrompt;      // ALW - Matches the GUID in the ChatBoxUI class.
-
 	const float		        mMaxHours;
 	const float			    mMinHours;
 	const int			    mFloatPrecision;
@@ -1,4 +1,6 @@
 #include "houseTrackerUI.h"
+#include "../Application/eventIdentifiers.h"
+#include "countText.h"
 #include "../Resources/resourceIdentifiers.h"
 
 #include "Trambo/Events/event.h"
@@ -16,9 +18,7 @@
 
 
 HouseTrackerUI::HouseTrackerUI(Fonts::ID font, trmb::FontHolder &fonts, SoundEffects::ID soundEffect, trmb::SoundPlayer &soundPlayer)
-: mBeginSimulationEvent(0x5000e550)
-, mBeginScoreboardEvent(0xf5e88b6e)
-, mSoundPlayer(soundPlayer)
+: mSoundPlayer(soundPlayer)
 , mBackground()
 , mMosquitoTextBackground()
 , mMosquitoText(trmb::Localize::getInstance().getString("mosquitoesUI"), fonts.get(font), 13u)
@@ -38,6 +38,9 @@ HouseTrackerUI::HouseTrackerUI(Fonts::ID font, trmb::FontHolder &fonts, SoundEff
 	const sf::Color outlineColor = sf::Color(0u, 0u, 0u, 255u);
 	const float outlineThickness = 1.0f;
 
+	reserveCountText(mInfectedMosquitoCountText);
+	reserveCountText(mMosquitoTotalText);
+
 	mBackground.setSize(ui);
 	mBackground.setFillColor(backgroundColor0);
 	mBackground.setOutlineColor(outlineColor);
@@ -86,11 +89,29 @@ sf::Vector2f HouseTrackerUI::getSize() const
 	return mBackground.getSize();
 }
 
+void HouseTrackerUI::setInfectedMosquitoCount(int count)
+{
+	mInfectedMosquitoCount = count;
+	assert(("Count cannot be less than 0.", 0 <= mInfectedMosquitoCount));
+
+	setCountText(mInfectedMosquitoCountText, mInfectedMosquitoCount);
+	trmb::centerOrigin(mInfectedMosquitoCountText, true, false);
+}
+
+void HouseTrackerUI::setMosquitoTotal(int total)
+{
+	mMosquitoTotal = total;
+	assert(("Count cannot be less than 0.", 0 <= mMosquitoTotal));
+
+	setCountText(mMosquitoTotalText, mMosquitoTotal);
+	trmb::centerOrigin(mMosquitoTotalText, true, false);
+}
+
 void HouseTrackerUI::addInfectedMosquito()
 {
 	++mInfectedMosquitoCount;
 
-	mInfectedMosquitoCountText.setString(std::to_string(mInfectedMosquitoCount));
+	setCountText(mInfectedMosquitoCountText, mInfectedMosquitoCount);
 	trmb::centerOrigin(mInfectedMosquitoCountText, true, false);
 }
 
@@ -99,7 +120,7 @@ void HouseTrackerUI::subtractInfectedMosquito()
 	--mInfectedMosquitoCount;
 	assert(("Count cannot be less than 0.", 0 <= mInfectedMosquitoCount));
 
-	mInfectedMosquitoCountText.setString(std::to_string(mInfectedMosquitoCount));
+	setCountText(mInfectedMosquitoCountText, mInfectedMosquitoCount);
 	trmb::centerOrigin(mInfectedMosquitoCountText, true, false);
 }
 
@@ -107,7 +128,7 @@ void HouseTrackerUI::addMosquitoTotal()
 {
 	++mMosquitoTotal;
 
-	mMosquitoTotalText.setString(std::to_string(mMosquitoTotal));
+	setCountText(mMosquitoTotalText, mMosquitoTotal);
 	trmb::centerOrigin(mMosquitoTotalText, true, false);
 }
 
@@ -116,17 +137,17 @@ void HouseTrackerUI::subtractMosquitoTotal()
 	--mMosquitoTotal;
 	assert(("Count cannot be less than 0.", 0 <= mMosquitoTotal));
 
-	mMosquitoTotalText.setString(std::to_string(mMosquitoTotal));
+	setCountText(mMosquitoTotalText, mMosquitoTotal);
 	trmb::centerOrigin(mMosquitoTotalText, true, false);
 }
 
 void HouseTrackerUI::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mBeginSimulationEvent == gameEvent.getType())
+	if (Events::BeginSimulation == gameEvent.getType())
 	{
 		unhide();
 	}
-	else if (mBeginScoreboardEvent == gameEvent.getType())
+	else if (Events::BeginScoreboard == gameEvent.getType())
 	{
 		hide();
 	}
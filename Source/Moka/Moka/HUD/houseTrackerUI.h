@@ -33,6 +33,9 @@ public:
 
 	sf::Vector2f		    getSize() const;
 
+	void				    setInfectedMosquitoCount(int count);
+	void				    setMosquitoTotal(int total);
+
 	void				    addInfectedMosquito();
 	void				    subtractInfectedMosquito();
 
@@ -42,10 +45,6 @@ public:
 	virtual void		    handleEvent(const trmb::Event &gameEvent) final;
 
 
-private:
-	using                   EventGuid = unsigned long;
-
-
 private:
 	virtual void		    draw(sf::RenderTarget &target, sf::RenderStates states) const final;
 	void				    unhide();
@@ -53,9 +52,6 @@ private:
 
 
 private:
-	const EventGuid			mBeginSimulationEvent; // ALW - Matches the GUID in the DaylightUI class.
-	const EventGuid			mBeginScoreboardEvent; // ALW - Matches the GUID in the World class.
-
 	trmb::SoundPlayer	    &mSoundPlayer;
 
 	sf::RectangleShape	    mBackground;
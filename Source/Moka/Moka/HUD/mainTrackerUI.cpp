@@ -1,4 +1,7 @@
 #include "mainTrackerUI.h"
+#include "../Application/eventIdentifiers.h"
+#include "countText.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Events/event.h"
 #include "Trambo/Localize/localize.h"
@@ -17,11 +20,7 @@
 
 MainTrackerUI::MainTrackerUI(const sf::RenderWindow &window, Fonts::ID font, const trmb::FontHolder &fonts, SoundEffects::ID soundEffect
 	, trmb::SoundPlayer &soundPlayer)
-: mBeginSimulationEvent(0x5000e550)
-, mBeginScoreboardEvent(0xf5e88b6e)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mWindow(window)
+: mWindow(window)
 , mSoundPlayer(soundPlayer)
 , mBackground()
 , mMosquitoTextBackground()
@@ -60,6 +59,11 @@ MainTrackerUI::MainTrackerUI(const sf::RenderWindow &window, Fonts::ID font, con
 	const sf::Color outlineColor = sf::Color(0u, 0u, 0u, 255u);
 	const float outlineThickness = 1.0f;
 
+	reserveCountText(mInfectedMosquitoCountText);
+	reserveCountText(mMosquitoCountText);
+	reserveCountText(mInfectedResidentCountText);
+	reserveCountText(mResidentCountText);
+
 	// ALW - Used to align the mosquito and resident UI.
 	mBackground.setSize(ui);
 	mBackground.setFillColor(backgroundColor);
@@ -236,7 +240,7 @@ void MainTrackerUI::setMosquitoCount(int count)
 {
 	mMosquitoCount = count;
 
-	mMosquitoCountText.setString(std::to_string(mMosquitoCount));
+	setCountText(mMosquitoCountText, mMosquitoCount);
 	trmb::centerOrigin(mMosquitoCountText, true, false);
 }
 
@@ -244,15 +248,24 @@ void MainTrackerUI::setResidentCount(int count)
 {
 	mResidentCount = count;
 
-	mResidentCountText.setString(std::to_string(mResidentCount));
+	setCountText(mResidentCountText, mResidentCount);
 	trmb::centerOrigin(mResidentCountText, true, false);
 }
 
+void MainTrackerUI::setInfectedMosquitoCount(int count)
+{
+	mInfectedMosquitoCount = count;
+	assert(("Count cannot be less than 0.", 0 <= mInfectedMosquitoCount));
+
+	setCountText(mInfectedMosquitoCountText, mInfectedMosquitoCount);
+	trmb::centerOrigin(mInfectedMosquitoCountText, true, false);
+}
+
 void MainTrackerUI::addMosquito()
 {
 	++mMosquitoCount;
 
-	mMosquitoCountText.setString(std::to_string(mMosquitoCount));
+	setCountText(mMosquitoCountText, mMosquitoCount);
 	trmb::centerOrigin(mMosquitoCountText, true, false);
 }
 
@@ -260,7 +273,7 @@ void MainTrackerUI::addInfectedMosquito()
 {
 	++mInfectedMosquitoCount;
 
-	mInfectedMosquitoCountText.setString(std::to_string(mInfectedMosquitoCount));
+	setCountText(mInfectedMosquitoCountText, mInfectedMosquitoCount);
 	trmb::centerOrigin(mInfectedMosquitoCountText, true, false);
 }
 
@@ -269,7 +282,7 @@ void MainTrackerUI::subtractInfectedMosquito()
 	--mInfectedMosquitoCount;
 	assert(("Count cannot be less than 0.", 0 <= mInfectedMosquitoCount));
 
-	mInfectedMosquitoCountText.setString(std::to_string(mInfectedMosquitoCount));
+	setCountText(mInfectedMosquitoCountText, mInfectedMosquitoCount);
 	trmb::centerOrigin(mInfectedMosquitoCountText, true, false);
 }
 
@@ -277,7 +290,7 @@ void MainTrackerUI::addInfectedResident()
 {
 	++mInfectedResidentCount;
 
-	mInfectedResidentCountText.setString(std::to_string(mInfectedResidentCount));
+	setCountText(mInfectedResidentCountText, mInfectedResidentCount);
 	trmb::centerOrigin(mInfectedResidentCountText, true, false);
 }
 
@@ -286,22 +299,49 @@ void MainTrackerUI::subtractInfectedResident()
 	--mInfectedResidentCount;
 	assert(("Count cannot be less than 0.", 0 <= mInfectedResidentCount));
 
-	mInfectedResidentCountText.setString(std::to_string(mInfectedResidentCount));
+	setCountText(mInfectedResidentCountText, mInfectedResidentCount);
+	trmb::centerOrigin(mInfectedResidentCountText, true, false);
+}
+
+void MainTrackerUI::save(Snapshot &snapshot) const
+{
+	snapshot.write(mMosquitoCount);
+	snapshot.write(mInfectedMosquitoCount);
+	snapshot.write(mResidentCount);
+	snapshot.write(mInfectedResidentCount);
+}
+
+void MainTrackerUI::load(Snapshot &snapshot)
+{
+	int mosquitoCount = 0;
+	int infectedMosquitoCount = 0;
+	int residentCount = 0;
+	snapshot.read(mosquitoCount);
+	snapshot.read(infectedMosquitoCount);
+	snapshot.read(residentCount);
+	snapshot.read(mInfectedResidentCount);
+	assert(("Count cannot be less than 0.", 0 <= mInfectedResidentCount));
+
+	setMosquitoCount(mosquitoCount);
+	setInfectedMosquitoCount(infectedMosquitoCount);
+	setResidentCount(residentCount);
+
+	setCountText(mInfectedResidentCountText, mInfectedResidentCount);
 	trmb::centerOrigin(mInfectedResidentCountText, true, false);
 }
 
 void MainTrackerUI::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
-	else if (mBeginSimulationEvent == gameEvent.getType())
+	else if (Events::BeginSimulation == gameEvent.getType())
 	{
 		unhide();
 	}
-	else if (mBeginScoreboardEvent == gameEvent.getType())
+	else if (Events::BeginScoreboard == gameEvent.getType())
 	{
 		hide();
 	}
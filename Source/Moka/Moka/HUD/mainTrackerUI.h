@@ -27,6 +27,8 @@ namespace trmb
 	class SoundPlayer;
 }
 
+class Snapshot;
+
 class MainTrackerUI : public sf::Transformable, public sf::Drawable, public trmb::EventHandler
 {
 public:
@@ -43,6 +45,7 @@ public:
 
 	void					setMosquitoCount(int count);
 	void					setResidentCount(int count);
+	void					setInfectedMosquitoCount(int count);
 
 	void				    addMosquito();
 
@@ -52,11 +55,10 @@ public:
 	void				    addInfectedResident();
 	void				    subtractInfectedResident();
 
-	virtual void		    handleEvent(const trmb::Event &gameEvent) final;
-
+	void					save(Snapshot &snapshot) const;
+	void					load(Snapshot &snapshot);
 
-private:
-	using                   EventGuid = unsigned long;
+	virtual void		    handleEvent(const trmb::Event &gameEvent) final;
 
 
 private:
@@ -69,11 +71,6 @@ private:
 
 
 private:
-	const EventGuid			mBeginSimulationEvent; // ALW - Matches the GUID in the DaylightUI class.
-	const EventGuid			mBeginScoreboardEvent; // ALW - Matches the GUID in the World class.
-	const EventGuid		    mFullscreen;		   // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid		    mWindowed;		       // ALW - Matches the GUID in the ToggleFullscreen class.
-
 	const sf::RenderWindow	&mWindow;
 	trmb::SoundPlayer	    &mSoundPlayer;
 
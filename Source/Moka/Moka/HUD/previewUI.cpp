@@ -0,0 +1,155 @@
+#include "previewUI.h"
+#include "../Application/eventIdentifiers.h"
+#include "countText.h"
+#include "daylightUI.h"
+
+#include "Trambo/Events/event.h"
+#include "Trambo/Localize/localize.h"
+#include "Trambo/Utilities/utility.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <cmath>
+#include <string>
+
+
+PreviewUI::PreviewUI(const sf::RenderWindow &window, Fonts::ID font, const trmb::FontHolder &fonts, const DaylightUI &daylightUI)
+: mWindow(window)
+, mDaylightUI(daylightUI)
+, mBackground()
+, mTitleBackground()
+, mEstimateBackground()
+, mTitleText(trmb::Localize::getInstance().getString("previewUI"), fonts.get(font), 13u)
+, mEstimateText("...", fonts.get(font), 13u)
+, mHide(false)
+{
+	const float buffer = 3;
+	const sf::Vector2f elementSize = sf::Vector2f(130.0f, 20.0f);
+	const sf::Vector2f backgroundSize = sf::Vector2f(elementSize.x, elementSize.y * 2.0f + buffer);
+	const sf::Color translucentColor = sf::Color(0u, 0u, 0u, 0u);
+	const sf::Color backgroundColor = sf::Color(0u, 0u, 0u, 200u);
+	const sf::Color outlineColor = sf::Color(0u, 0u, 0u, 255u);
+	const float outlineThickness = 1.0f;
+
+	reserveCountText(mEstimateText);
+
+	mBackground.setSize(backgroundSize);
+	mBackground.setFillColor(translucentColor);
+	mBackground.setOutlineColor(outlineColor);
+	mBackground.setOutlineThickness(outlineThickness);
+	mBackground.setPosition(0.0f, 0.0f);
+
+	mTitleBackground.setSize(elementSize);
+	mTitleBackground.setFillColor(backgroundColor);
+	mTitleBackground.setOutlineColor(outlineColor);
+	mTitleBackground.setOutlineThickness(outlineThickness);
+	mTitleBackground.setPosition(0.0f, 0.0f);
+
+	mEstimateBackground.setSize(elementSize);
+	mEstimateBackground.setFillColor(backgroundColor);
+	mEstimateBackground.setOutlineColor(outlineColor);
+	mEstimateBackground.setOutlineThickness(outlineThickness);
+	mEstimateBackground.setPosition(0.0f, elementSize.y + buffer);
+
+	trmb::centerOrigin(mTitleText, true, true);
+	mTitleText.setPosition(sf::Vector2f(std::floor(elementSize.x / 2.0f), std::floor(elementSize.y / 2.0f)));
+
+	mEstimateText.setColor(sf::Color::Red);
+	trmb::centerOrigin(mEstimateText, true, true);
+	mEstimateText.setPosition(sf::Vector2f(std::floor(elementSize.x / 2.0f), std::floor(elementSize.y + buffer + elementSize.y / 2.0f)));
+
+	repositionGUI();
+}
+
+sf::Vector2f PreviewUI::getSize() const
+{
+	return mBackground.getSize();
+}
+
+bool PreviewUI::isHidden() const
+{
+	return mHide;
+}
+
+void PreviewUI::setPending()
+{
+	mEstimateText.setString("...");
+	trmb::centerOrigin(mEstimateText, true, true);
+}
+
+void PreviewUI::setEstimate(int minInfections, int maxInfections)
+{
+	if (minInfections == maxInfections)
+		setCountText(mEstimateText, minInfections);
+	else
+		setCountRangeText(mEstimateText, minInfections, maxInfections);
+
+	trmb::centerOrigin(mEstimateText, true, true);
+}
+
+void PreviewUI::handleEvent(const trmb::Event &gameEvent)
+{
+	// ALW - Currently, fullscreen and windowed mode are the same.
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
+	{
+		repositionGUI();
+	}
+	else if (Events::BeginSimulation == gameEvent.getType())
+	{
+		hide();
+	}
+}
+
+void PreviewUI::draw(sf::RenderTarget &target, sf::RenderStates states) const
+{
+	states.transform *= getTransform();
+
+	// ALW - Save then change view
+	sf::View previousView = target.getView();
+	target.setView(target.getDefaultView());
+
+	if (!mHide)
+	{
+		target.draw(mBackground, states);
+		target.draw(mTitleBackground, states);
+		target.draw(mEstimateBackground, states);
+
+		target.draw(mTitleText, states);
+		target.draw(mEstimateText, states);
+	}
+
+	// ALW - Restore the view
+	target.setView(previousView);
+}
+
+void PreviewUI::hide()
+{
+	mHide = true;
+}
+
+void PreviewUI::repositionGUI()
+{
+	// ALW - The DaylightUI is centered on the window, so this sits just past its right edge.
+	const sf::Vector2f windowCenter = sf::Vector2f(mWindow.getSize() / 2u);
+	const float bufferFromTop = 10.0f;
+	const float bufferFromDaylightUI = 10.0f;
+	setPosition(windowCenter.x + std::floor(mDaylightUI.getSize().x / 2.0f) + bufferFromDaylightUI, bufferFromTop);
+}
+
+void centerOrigin(PreviewUI &ui, bool centerXAxis, bool centerYAxis)
+{
+	sf::Vector2f size = ui.getSize();
+	float xAxis = 0.0f;
+	float yAxis = 0.0f;
+
+	if (centerXAxis)
+		xAxis = std::floor(size.x / 2.0f);
+
+	if (centerYAxis)
+		yAxis = std::floor(size.y / 2.0f);
+
+	ui.setOrigin(xAxis, yAxis);
+}
@@ -0,0 +1,71 @@
+#ifndef PREVIEW_UI_H
+#define PREVIEW_UI_H
+
+#include "../Resources/resourceIdentifiers.h"
+
+#include "Trambo/Events/eventHandler.h"
+#include "Trambo/Resources/resourceHolder.h"
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <SFML/Graphics/Text.hpp>
+
+
+namespace sf
+{
+	class RenderStates;
+	class RenderTarget;
+	class RenderWindow;
+}
+
+namespace trmb
+{
+	class Event;
+}
+
+class DaylightUI;
+
+// ALW - Shows the range of infections the PreviewWorker expects from the current plan. It sits to the right of
+// ALW - the DaylightUI and is only shown while the player is buying preventions.
+class PreviewUI : public sf::Transformable, public sf::Drawable, public trmb::EventHandler
+{
+public:
+							PreviewUI(const sf::RenderWindow &window, Fonts::ID font, const trmb::FontHolder &fonts
+								, const DaylightUI &daylightUI);
+							PreviewUI(const PreviewUI &) = delete;
+	PreviewUI				operator=(const PreviewUI &) = delete;
+
+	sf::Vector2f		    getSize() const;
+	bool					isHidden() const;
+
+	void					setPending();
+	void					setEstimate(int minInfections, int maxInfections);
+	void				    hide();
+
+	virtual void		    handleEvent(const trmb::Event &gameEvent) final;
+
+
+private:
+	virtual void		    draw(sf::RenderTarget &target, sf::RenderStates states) const final;
+	void				    repositionGUI();
+
+
+private:
+	const sf::RenderWindow	&mWindow;
+	const DaylightUI		&mDaylightUI;
+
+	sf::RectangleShape	    mBackground;
+	sf::RectangleShape	    mTitleBackground;
+	sf::RectangleShape	    mEstimateBackground;
+	sf::Text			    mTitleText;
+	sf::Text			    mEstimateText;
+
+	bool                    mHide;
+};
+
+void	centerOrigin(PreviewUI &ui, bool centerXAxis = true, bool centerYAxis = true);
+
+#endif
@@ -1,4 +1,6 @@
 #include "scoreboardUI.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Camera/camera.h"
 #include "Trambo/Events/event.h"
@@ -17,10 +19,7 @@
 
 ScoreboardUI::ScoreboardUI(const sf::RenderWindow &window, trmb::Camera &camera, trmb::FontHolder &fonts, SoundEffects::ID soundEffect
 	, trmb::SoundPlayer &soundPlayer, EventGuid leftClickPress, EventGuid leftClickRelease)
-: mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mBeginScoreboardEvent(0xf5e88b6e)
-, mWindow(window)
+: mWindow(window)
 , mCamera(camera)
 , mFonts(fonts)
 , mSoundPlayer(soundPlayer)
@@ -46,6 +45,13 @@ ScoreboardUI::ScoreboardUI(const sf::RenderWindow &window, trmb::Camera &camera,
 , mNetDeflections(0)
 , mCuredResident(0)
 , mInfectedResident(1) // ALW - Patient zero
+, mHasExpectedResults(false)
+, mExpectedSpawnedMosquitoes(0.0f)
+, mExpectedDoorDeflections(0.0f)
+, mExpectedWindowDeflections(0.0f)
+, mExpectedNetDeflections(0.0f)
+, mExpectedCuredResident(0.0f)
+, mExpectedInfectedResident(0.0f)
 , mContainer(leftClickPress, leftClickRelease)
 , mHide(true)
 , mDisable(true)
@@ -56,12 +62,12 @@ ScoreboardUI::ScoreboardUI(const sf::RenderWindow &window, trmb::Camera &camera,
 void ScoreboardUI::initialize(int totalResidents)
 {
 	// ALW - Initialize text with results
-	mBarrelResultText.setString(std::to_string(mSpawnedMosquitoes));
-	mDoorResultText.setString(std::to_string(mDoorDeflections));
-	mWindowResultText.setString(std::to_string(mWindowDeflections));
-	mNetResultText.setString(std::to_string(mNetDeflections));
-	mCuredResultText.setString(std::to_string(mCuredResident));
-	mMalariaResultText.setString(std::to_string(mInfectedResident));
+	mBarrelResultText.setString(getResultString(mSpawnedMosquitoes, mExpectedSpawnedMosquitoes));
+	mDoorResultText.setString(getResultString(mDoorDeflections, mExpectedDoorDeflections));
+	mWindowResultText.setString(getResultString(mWindowDeflections, mExpectedWindowDeflections));
+	mNetResultText.setString(getResultString(mNetDeflections, mExpectedNetDeflections));
+	mCuredResultText.setString(getResultString(mCuredResident, mExpectedCuredResident));
+	mMalariaResultText.setString(getResultString(mInfectedResident, mExpectedInfectedResident));
 
 	// ALW - Position the text
 	const float margin = 3.0f;
@@ -205,6 +211,54 @@ void ScoreboardUI::addInfectedResident()
 	++mInfectedResident;
 }
 
+void ScoreboardUI::setExpectedResults(float mosquitoSpawns, float doorDeflections, float windowDeflections
+	, float netDeflections, float curedResidents, float infectedResidents)
+{
+	mHasExpectedResults = true;
+	mExpectedSpawnedMosquitoes = mosquitoSpawns;
+	mExpectedDoorDeflections = doorDeflections;
+	mExpectedWindowDeflections = windowDeflections;
+	mExpectedNetDeflections = netDeflections;
+	mExpectedCuredResident = curedResidents;
+	mExpectedInfectedResident = infectedResidents;
+}
+
+void ScoreboardUI::save(Snapshot &snapshot) const
+{
+	snapshot.write(mSpawnedMosquitoes);
+	snapshot.write(mDoorDeflections);
+	snapshot.write(mWindowDeflections);
+	snapshot.write(mNetDeflections);
+	snapshot.write(mCuredResident);
+	snapshot.write(mInfectedResident);
+
+	snapshot.write(mHasExpectedResults);
+	snapshot.write(mExpectedSpawnedMosquitoes);
+	snapshot.write(mExpectedDoorDeflections);
+	snapshot.write(mExpectedWindowDeflections);
+	snapshot.write(mExpectedNetDeflections);
+	snapshot.write(mExpectedCuredResident);
+	snapshot.write(mExpectedInfectedResident);
+}
+
+void ScoreboardUI::load(Snapshot &snapshot)
+{
+	snapshot.read(mSpawnedMosquitoes);
+	snapshot.read(mDoorDeflections);
+	snapshot.read(mWindowDeflections);
+	snapshot.read(mNetDeflections);
+	snapshot.read(mCuredResident);
+	snapshot.read(mInfectedResident);
+
+	snapshot.read(mHasExpectedResults);
+	snapshot.read(mExpectedSpawnedMosquitoes);
+	snapshot.read(mExpectedDoorDeflections);
+	snapshot.read(mExpectedWindowDeflections);
+	snapshot.read(mExpectedNetDeflections);
+	snapshot.read(mExpectedCuredResident);
+	snapshot.read(mExpectedInfectedResident);
+}
+
 void ScoreboardUI::handler()
 {
 	if (!mDisable)
@@ -221,11 +275,11 @@ void ScoreboardUI::handler()
 void ScoreboardUI::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
-	else if (mBeginScoreboardEvent == gameEvent.getType())
+	else if (Events::BeginScoreboard == gameEvent.getType())
 	{
 		unhide();
 	}
@@ -326,6 +380,17 @@ void ScoreboardUI::leftJustify(sf::Text &text)
 	text.setOrigin(sf::Vector2f(text.getLocalBounds().width, 0.0f));
 }
 
+std::string ScoreboardUI::getResultString(int result, float expectedResult) const
+{
+	std::ostringstream stream;
+	stream << result;
+
+	if (mHasExpectedResults)
+		stream << " (" << std::fixed << std::setprecision(1) << expectedResult << ")";
+
+	return stream.str();
+}
+
 void ScoreboardUI::enable()
 {
 	mDisable = false;
@@ -32,6 +32,8 @@ namespace trmb
 	class SoundPlayer;
 }
 
+class Snapshot;
+
 class ScoreboardUI : public sf::Transformable, public sf::Drawable, public trmb::EventHandler
 {
 public:
@@ -58,6 +60,13 @@ public:
 	void					addCuredResident();
 	void					addInfectedResident();
 
+	// ALW - The MarkovEvaluator's expected results, shown in brackets after the actual results.
+	void					setExpectedResults(float mosquitoSpawns, float doorDeflections, float windowDeflections
+								, float netDeflections, float curedResidents, float infectedResidents);
+
+	void					save(Snapshot &snapshot) const;
+	void					load(Snapshot &snapshot);
+
 	void				    handler();
 	virtual void		    handleEvent(const trmb::Event &gameEvent) final;
 
@@ -73,6 +82,7 @@ private:
 	float					getMaxResultTextLength();
 	float					getMaxDescTextLength();
 	void					leftJustify(sf::Text &text);
+	std::string				getResultString(int result, float expectedResult) const;
 
 	void					enable();
 	void					disable();
@@ -83,10 +93,6 @@ private:
 
 
 private:
-	const EventGuid		    mFullscreen;		   // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid		    mWindowed;		       // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid			mBeginScoreboardEvent; // ALW - Matches the GUID in the World class.
-
 	const sf::RenderWindow	&mWindow;
 	trmb::Camera			&mCamera;
 	trmb::FontHolder		&mFonts;
@@ -116,6 +122,14 @@ private:
 	int                     mCuredResident;
 	int						mInfectedResident;
 
+	bool					mHasExpectedResults;
+	float					mExpectedSpawnedMosquitoes;
+	float					mExpectedDoorDeflections;
+	float					mExpectedWindowDeflections;
+	float					mExpectedNetDeflections;
+	float					mExpectedCuredResident;
+	float					mExpectedInfectedResident;
+
 	ButtonPtr               mButton;
 	trmb::ButtonContainer   mContainer;
 
@@ -73,8 +73,8 @@ private:
 
 
 private:
-	const EventGuid			mLeftClickPress;	// ALW - Matches the GUID in the Controller class.
-	const EventGuid			mLeftClickRelease;	// ALW - Matches the GUID in the Controller class.
+	const EventGuid			mLeftClickPress;
+	const EventGuid			mLeftClickRelease;
 	Fonts::ID				mFont;
 	trmb::FontHolder&		mFonts;
 	SoundEffects::ID		mSoundEffect;
@@ -1,26 +1,32 @@
 #include "world.h"
+#include "../Application/allocationCounter.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/eventQueue.h"
+#include "../Application/memoryTracker.h"
+#include "../Application/voicePool.h"
 #include "../SceneNodes/barrelNode.h"
-#include "../SceneNodes/barrelUpdateNode.h"
 #include "../SceneNodes/barrelUINode.h"
 #include "../SceneNodes/darkness.h"
 #include "../SceneNodes/doorNode.h"
 #include "../SceneNodes/doorUINode.h"
-#include "../SceneNodes/doorUpdateNode.h"
 #include "../SceneNodes/windowNode.h"
 #include "../SceneNodes/windowUINode.h"
-#include "../SceneNodes/windowUpdateNode.h"
 #include "../SceneNodes/clinicNode.h"
 #include "../SceneNodes/clinicUINode.h"
-#include "../SceneNodes/clinicUpdateNode.h"
+#include "../SceneNodes/culledLayerNode.h"
 #include "../SceneNodes/heroNode.h"
 #include "../SceneNodes/houseNode.h"
 #include "../SceneNodes/houseUINode.h"
-#include "../SceneNodes/houseUpdateNode.h"
+#include "../SceneNodes/interiorBatch.h"
 #include "../SceneNodes/mosquitoNode.h"
 #include "../SceneNodes/residentNode.h"
-#include "../SceneNodes/residentUpdateNode.h"
 #include "../GameObjects/interactiveObject.h"
+#include "../Resources/assetCache.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/markovEvaluator.h"
+#include "../Simulation/simulationRandom.h"
+#include "../Simulation/snapshot.h"
+#include "../Simulation/transmissionRates.h"
 
 #include "Trambo/Events/event.h"
 #include "Trambo/Localize/localize.h"
@@ -33,57 +39,67 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Window/Event.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
 
 
-World::World(sf::RenderWindow& window, trmb::FontHolder& fonts, trmb::SoundPlayer& soundPlayer, trmb::MusicPlayer& musicPlayer)
-: mBeginScoreboardEvent(0xf5e88b6e)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mCreateTextPrompt(0x25e87fd8)
-, mClearTextPrompt(0xc1523265)
-, mBeginSimulationEvent(0x5000e550)
-, mSpawnMosquitoEvent(0xbd01d8d)
-, mWindow(window)
+World::World(sf::RenderWindow& window, trmb::FontHolder& fonts, trmb::SoundPlayer& soundPlayer, trmb::MusicPlayer& musicPlayer
+	, VoicePool& voicePool)
+: mWindow(window)
 , mTarget(window)
 , mFonts(fonts)
 , mSoundPlayer(soundPlayer)
 , mMusicPlayer(musicPlayer)
-, mTextures()
+, mVoicePool(voicePool)
+, mTextures(AssetCache::getInstance().getTextures())
 , mSceneGraph()
 , mSceneLayers()
-, mObjectGroups("Data/Maps/World.tmx")
-, mMap("Data/Maps/World.tmx")
-, mWorldBounds(0.f, 0.f, static_cast<float>(mMap.getWidth() * mMap.getTileWidth()), static_cast<float>(mMap.getHeight() * mMap.getTileHeight()))
+, mCulledLayers()
+, mObjectGroups(AssetCache::getInstance().getObjectGroups("Data/Maps/World.tmx"))
+, mSceneTemplate(AssetCache::getInstance().getSceneTemplate("Data/Maps/World.tmx"))
+, mHouseTileMask(mSceneTemplate->getHouseTileMask())
+, mRegistry(*mSceneTemplate)
+, mFlowField(mObjectGroups->getInteractiveGroup().getWidth(), mObjectGroups->getInteractiveGroup().getHeight())
+, mCompartmentalModel(mObjectGroups->getInteractiveGroup(), mHouseTileMask, mFlowField)
+, mScheduler()
+, mSwarmClock()
+, mMap(AssetCache::getInstance().getMap("Data/Maps/World.tmx"))
+, mWorldBounds(0.f, 0.f, static_cast<float>(mMap->getWidth() * mMap->getTileWidth()), static_cast<float>(mMap->getHeight() * mMap->getTileHeight()))
 , mCamera(window.getDefaultView(), mWorldBounds)
 , mHeroPosition(mWorldBounds.width / 2.f, mWorldBounds.height / 2.f)
 , mHero(nullptr)
 , mUIBundle(mChatBoxUI, mDaylightUI, mBarrelUI, mDoorUI, mWindowUI, mClinicUI, mHouseUI)
-, mChatBoxUI(window, mCamera, Fonts::ID::Main, fonts, SoundEffects::ID::Chat, soundPlayer, mUIBundle)
-, mDaylightUI(window, mCamera, Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, mUIBundle, 0x6955d309, 0x128b8b25)
+, mChatBoxUI(window, mCamera, Fonts::ID::Main, fonts, SoundEffects::ID::Chat, voicePool, mUIBundle)
+, mDaylightUI(window, mCamera, Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, mUIBundle, Events::LeftClickPress, Events::LeftClickRelease)
 , mMainTrackerUI(window, Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer)
-, mBarrelUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, 0x6955d309, 0x128b8b25)
-, mDoorUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, 0x6955d309, 0x128b8b25)
-, mWindowUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, 0x6955d309, 0x128b8b25)
-, mClinicUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, 0x6955d309, 0x128b8b25)
-, mHouseUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, 0x6955d309, 0x128b8b25)
-, mMosquitoCount(500)
+, mBarrelUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, Events::LeftClickPress, Events::LeftClickRelease)
+, mDoorUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, Events::LeftClickPress, Events::LeftClickRelease)
+, mWindowUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, Events::LeftClickPress, Events::LeftClickRelease)
+, mClinicUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, Events::LeftClickPress, Events::LeftClickRelease)
+, mHouseUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer, Events::LeftClickPress, Events::LeftClickRelease)
+, mMousePicker(window, mCamera.getView(), mUIBundle, mObjectGroups->getInteractiveGroup(), mRegistry)
+, mSpawnSampler(mObjectGroups->getInteractiveGroup().getWidth(), mObjectGroups->getInteractiveGroup().getHeight())
+, mMosquitoCount(mObjectGroups->getMosquitoCount())
 , mResidentCount(0)
-, mSpawnPositions()
 , mDisableInput(false)
 , mSimulationMode(false)
 , mTotalCollisionTime(sf::seconds(1.0))
-, mUpdateCollisionTime()
+, mCollisionEvent(EventScheduler::noEvent)
 , mBarrelIDsToSpawnMosquito()
 , mBarrels()
+, mMosquitoPool(mTextures, mWorldBounds, mHouseTileMask, mFlowField, mScheduler, mSwarmClock)
 , mClinicCount(0)
 , mClinic(nullptr)
-, mDoorToHouse()
-, mWindowToHouse()
-, mResidentToHouse()
-, mEventDialogManager(mChatBoxUI, mDidYouKnow, soundPlayer)
+, mMosquitoes()
+, mActiveMosquitoes()
+, mHouseResidents()
+, mDispatchedEvents()
+, mEventDialogManager(mChatBoxUI, mDidYouKnow, mScheduler, voicePool)
 , mDidYouKnow(11)			// ALW - Total number of DidYouKnow facts in Text.xml
 , mDoors()
 , mHouses()
@@ -95,20 +111,60 @@ World::World(sf::RenderWindow& window, trmb::FontHolder& fonts, trmb::SoundPlaye
 , mDisplaySimulationFinishedEventDialog(true)
 , mTransmissionCount(0)
 , mDisableMosquitoPopulationCheck(false)
-, mScoreboardUI(window, mCamera, fonts, SoundEffects::ID::Button, soundPlayer, 0x6955d309, 0x128b8b25)
+, mScoreboardUI(window, mCamera, fonts, SoundEffects::ID::Button, soundPlayer, Events::LeftClickPress, Events::LeftClickRelease)
+, mMaxMosquitoNodes(5000)
+, mAggregateMode(mObjectGroups->isAggregateMode() || mMosquitoCount > mMaxMosquitoNodes)
+, mReportedMosquitoSpawns(0)
+, mReportedDoorDeflections(0)
+, mReportedWindowDeflections(0)
+, mReportedNetDeflections(0)
+, mReportedCuredResidents(0)
+, mSnapshotID(0x4d4f4b41)
+, mSnapshotVersion(5)
+, mNightLayout()
+, mPreviewUI(window, Fonts::ID::Main, fonts, mDaylightUI)
+, mPreviewWorker()
+, mPreviewPlanRevision(0)
+, mPreviewRDTs(-1)			// ALW - No plan has been previewed yet
+, mPreviewACTs(-1)
 {
-	mTextures.load(Textures::ID::Tiles, "Data/Textures/Tiles.png");
-	mTextures.load(Textures::ID::InfectedMosquitoAnimation, "Data/Textures/InfectedMosquitoAnimation.png");
-	mTextures.load(Textures::ID::MosquitoAnimation, "Data/Textures/MosquitoAnimation.png");
-	mTextures.load(Textures::ID::RedCross, "Data/Textures/RedCross.png");
+	// ALW - Only the first World loads these. The next one finds them in the cache.
+	AssetCache &assetCache = AssetCache::getInstance();
+	assetCache.loadTexture(Textures::ID::Tiles, "Data/Textures/Tiles.png");
+	assetCache.loadTexture(Textures::ID::InfectedMosquitoAnimation, "Data/Textures/InfectedMosquitoAnimation.png");
+	assetCache.loadTexture(Textures::ID::MosquitoAnimation, "Data/Textures/MosquitoAnimation.png");
+	assetCache.loadTexture(Textures::ID::RedCross, "Data/Textures/RedCross.png");
 
-	generateSpawnPositions();
-	buildScene();
-	configureUIs();
+	// ALW - Matches the capacity of the EventQueue, so the two buffers can trade places without allocating.
+	const std::size_t eventCapacity = 64;
+	mDispatchedEvents.reserve(eventCapacity);
 
-	initializeDoorToHouseMap();
-	initializeWindowToHouseMap();
-	initializeResidentToHouseMap();
+	buildSpawnSampler();
+
+	{
+		MemoryTracker::Scope scope(MemoryTracker::SceneGraph);
+		buildScene();
+	}
+
+	{
+		MemoryTracker::Scope scope(MemoryTracker::HUD);
+		configureUIs();
+	}
+
+	buildNightLayout();
+
+	if (mAggregateMode)
+	{
+		initializeCompartmentalModel();
+		mPreviewUI.hide();
+	}
+}
+
+World::~World()
+{
+	// ALW - Events this world raised but never sent must not reach the next one.
+	EventQueue::getInstance().clear();
+	mVoicePool.clearRequests();
 }
 
 bool World::isScoreboardFinished() const
@@ -116,52 +172,295 @@ bool World::isScoreboardFinished() const
 	return mScoreboardUI.isFinished();
 }
 
+bool World::saveSnapshot(const std::string &filename) const
+{
+	// ALW - Only the night is saved. Build mode is short and is replayed by the player.
+	if (!mSimulationMode)
+		return false;
+
+	Snapshot snapshot;
+	writeSnapshot(snapshot);
+
+	// ALW - A read-only Data folder only costs the player the save.
+	try
+	{
+		snapshot.saveToFile(filename);
+	}
+	catch (const std::runtime_error &)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool World::loadSnapshot(const std::string &filename)
+{
+	// ALW - A snapshot is restored on top of a night that is already running, so every node is in
+	// ALW - simulation mode and the build mode UIs are already hidden.
+	if (!mSimulationMode)
+		return false;
+
+	Snapshot snapshot;
+	if (!snapshot.loadFromFile(filename) || !readSnapshotHeader(snapshot))
+		return false;
+
+	// ALW - A truncated file, or one taken on another map, is only found partway through the body. Keep the
+	// ALW - night as it is now, so a snapshot that fails to load can be undone instead of leaving it half restored.
+	Snapshot current;
+	writeSnapshot(current);
+	readSnapshotHeader(current);	// ALW - Moves past the header, which matches this night
+
+	try
+	{
+		readSnapshotBody(snapshot);
+	}
+	catch (const std::exception &)	// ALW - A corrupt count can also fail to allocate
+	{
+		readSnapshotBody(current);
+		return false;
+	}
+
+	return true;
+}
+
+void World::writeSnapshot(Snapshot &snapshot) const
+{
+	// ALW - Header. Everything loadSnapshot() can check before it changes the night.
+	snapshot.write(mSnapshotID);
+	snapshot.write(mSnapshotVersion);
+	snapshot.write(mAggregateMode);
+	snapshot.write(mMosquitoes.size());
+
+	SimulationRandom::getInstance().save(snapshot);
+
+	mScheduler.save(snapshot, mCollisionEvent);
+	snapshot.write(mBarrelIDsToSpawnMosquito.size());
+	for (const std::size_t barrelID : mBarrelIDsToSpawnMosquito)
+		snapshot.write(barrelID);
+
+	snapshot.write(mDisplayClinicEventDialog);
+	snapshot.write(mDisplayDoorEventDialog);
+	snapshot.write(mDisplayHouseEventDialog);
+	snapshot.write(mDisplayWindowEventDialog);
+	snapshot.write(mDisplaySimulationFinishedEventDialog);
+	snapshot.write(mTransmissionCount);
+	snapshot.write(mDisableMosquitoPopulationCheck);
+	snapshot.write(mReportedMosquitoSpawns);
+	snapshot.write(mReportedDoorDeflections);
+	snapshot.write(mReportedWindowDeflections);
+	snapshot.write(mReportedNetDeflections);
+	snapshot.write(mReportedCuredResidents);
+
+	mRegistry.save(snapshot);
+
+	for (const MosquitoNode * const mosquito : mMosquitoes)
+		mosquito->save(snapshot);
+	mMosquitoPool.save(snapshot);
+
+	for (const BarrelNode * const barrel : mBarrels)
+		barrel->save(snapshot);
+
+	for (std::size_t houseID = 0; houseID < mHouses.size(); ++houseID)
+	{
+		mHouses[houseID]->save(snapshot);
+		mHouseResidents[houseID]->save(snapshot);
+	}
+
+	mClinic->save(snapshot);
+	mDaylightUI.save(snapshot);
+	mEventDialogManager.save(snapshot);
+	mMainTrackerUI.save(snapshot);
+	mScoreboardUI.save(snapshot);
+
+	if (mAggregateMode)
+		mCompartmentalModel.save(snapshot);
+}
+
+bool World::readSnapshotHeader(Snapshot &snapshot) const
+{
+	// ALW - An old, foreign, or mismatched snapshot is expected input, so it is reported instead of thrown.
+	sf::Uint32 snapshotID = 0;
+	sf::Uint32 snapshotVersion = 0;
+	bool aggregateMode = false;
+	std::size_t mosquitoCount = 0;
+
+	try
+	{
+		snapshot.read(snapshotID);
+		snapshot.read(snapshotVersion);
+		snapshot.read(aggregateMode);
+		snapshot.read(mosquitoCount);
+	}
+	catch (const std::runtime_error &)
+	{
+		return false;
+	}
+
+	return mSnapshotID == snapshotID && mSnapshotVersion == snapshotVersion && mAggregateMode == aggregateMode
+		&& mMosquitoes.size() == mosquitoCount;
+}
+
+void World::readSnapshotBody(Snapshot &snapshot)
+{
+	SimulationRandom::getInstance().load(snapshot);
+
+	mCollisionEvent = mScheduler.load(snapshot, mCollisionEvent, std::bind(&World::updateCollisions, this));
+	std::size_t barrelSpawnCount = 0;
+	snapshot.read(barrelSpawnCount);
+	mBarrelIDsToSpawnMosquito.resize(barrelSpawnCount);
+	for (std::size_t &barrelID : mBarrelIDsToSpawnMosquito)
+	{
+		snapshot.read(barrelID);
+		if (barrelID >= mBarrels.size())
+			throw std::runtime_error("ALW - Runtime Error: The snapshot was taken on a different map.");
+	}
+
+	snapshot.read(mDisplayClinicEventDialog);
+	snapshot.read(mDisplayDoorEventDialog);
+	snapshot.read(mDisplayHouseEventDialog);
+	snapshot.read(mDisplayWindowEventDialog);
+	snapshot.read(mDisplaySimulationFinishedEventDialog);
+	snapshot.read(mTransmissionCount);
+	snapshot.read(mDisableMosquitoPopulationCheck);
+	snapshot.read(mReportedMosquitoSpawns);
+	snapshot.read(mReportedDoorDeflections);
+	snapshot.read(mReportedWindowDeflections);
+	snapshot.read(mReportedNetDeflections);
+	snapshot.read(mReportedCuredResidents);
+
+	mRegistry.load(snapshot);
+	buildFlowField();
+
+	for (MosquitoNode * const mosquito : mMosquitoes)
+		mosquito->load(snapshot);
+	mMosquitoPool.load(snapshot);
+
+	for (BarrelNode * const barrel : mBarrels)
+		barrel->load(snapshot);
+
+	for (std::size_t houseID = 0; houseID < mHouses.size(); ++houseID)
+	{
+		mHouses[houseID]->load(snapshot);
+		mHouseResidents[houseID]->load(snapshot);
+	}
+
+	mClinic->load(snapshot);
+	mDaylightUI.load(snapshot);
+	mEventDialogManager.load(snapshot);
+	mMainTrackerUI.load(snapshot);
+	mScoreboardUI.load(snapshot);
+
+	if (mAggregateMode)
+		mCompartmentalModel.load(snapshot);
+}
+
+std::vector<NightSimulation::State> World::forkNight(const std::vector<NightSimulation::Fork> &forks, sf::Time duration) const
+{
+	// ALW - The aggregate simulation has no mosquitoes to copy, so only the agent simulation can be forked.
+	if (!mSimulationMode || mAggregateMode)
+		return std::vector<NightSimulation::State>();
+
+	return NightSimulation::runForks(mNightLayout, captureNightState(), forks, duration);
+}
+
 void World::update(sf::Time dt)
 {
+#if defined(MOKA_TRACK_ALLOCATIONS) && !defined(NDEBUG)
+	const std::size_t allocationCount = AllocationCounter::getCount();
+	const std::size_t poolAllocations = mMosquitoPool.getStatistics().allocations;
+	const std::size_t previewPlanRevision = mPreviewPlanRevision;
+	const int previewRDTs = mPreviewRDTs;
+	const int previewACTs = mPreviewACTs;
+	const bool wasInputDisabled = mDisableInput;
+	const bool wasSimulationMode = mSimulationMode;
+#endif
+
+	// ALW - Events are sent at four points. The first sends what the input since the last frame raised, like a click
+	// ALW - that selected an object and opened a prompt.
+	dispatchEvents();
+
 	// ALW - Both modes
-	mSceneGraph.update(dt);					// ALW - Update the hero along with the rest of the scene graph
+	{
+		MemoryTracker::Scope scope(MemoryTracker::SceneGraph);
+		mSceneGraph.update(dt);					// ALW - Update the hero along with the rest of the scene graph
+	}
+
 	mCamera.update(mHero->getPosition());	// ALW - Update the camera position
-	updateSoundPlayer();
-	mChatBoxUI.handler();
 
-	// ALW - Build Mode
-	mDaylightUI.handler();
+	{
+		MemoryTracker::Scope scope(MemoryTracker::HUD);
+		mChatBoxUI.handler();
+
+		// ALW - Build Mode
+		mDaylightUI.handler();
+	}
 
-	// ALW - Simulation Mode
-	if (!mDisableInput)
-		updateCollisions(dt);
+	updatePreview();
 
-	// ALW - updateCollisions() can change the value of mDisableInput, so it should be checked again.
+	// ALW - The UIs may have cleared a prompt or begun the night, and either changes what is simulated below.
+	dispatchEvents();
+
+	// ALW - Simulation Mode. Mosquito moves, barrel spawns, collision passes, and event dialog intervals run
+	// ALW - as scheduled events, so a frame with nothing due does no simulation work.
 	if (mSimulationMode && !mDisableInput)
 	{
-		spawnBarrelMosquitoes();
+		mScheduler.advance(dt);
+		mSwarmClock.advance(dt);
+	}
+
+	// ALW - updateCollisions() can open a prompt, which changes the value of mDisableInput, so it should be checked again.
+	dispatchEvents();
+	if (mSimulationMode && !mDisableInput)
+	{
+		{
+			MemoryTracker::Scope scope(MemoryTracker::Mosquitoes);
+			spawnBarrelMosquitoes();
+		}
+
 		if (hasMosquitoPopulationDoubled())
 			mEventDialogManager.displayText(trmb::Localize::getInstance().getString("mosquitoPopulationEvent"));
 
-		updateScheduledEventDialog(dt);
+		updateScheduledEventDialog();
+	}
+
+	{
+		MemoryTracker::Scope scope(MemoryTracker::HUD);
+		mScoreboardUI.handler();
 	}
 
-	mScoreboardUI.handler();
+	// ALW - Nothing is left waiting when the frame is drawn.
+	dispatchEvents();
+	updateSoundPlayer();
+
+	// ALW - A frame that opens a prompt, starts or ends the night, previews a new plan, or grows the mosquito pool
+	// ALW - may allocate. Every other frame of the build and night phase should not.
+#if defined(MOKA_TRACK_ALLOCATIONS) && !defined(NDEBUG)
+	assert(("A normal frame allocated memory!", wasInputDisabled || mDisableInput || wasSimulationMode != mSimulationMode
+		|| previewPlanRevision != mPreviewPlanRevision || previewRDTs != mPreviewRDTs || previewACTs != mPreviewACTs
+		|| poolAllocations != mMosquitoPool.getStatistics().allocations
+		|| allocationCount == AllocationCounter::getCount()));
+#endif
 }
 
 void World::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		mCamera.setSize(mTarget.getDefaultView().getSize());
 
 		// ALW - Manually correct position of camera, necessary when pause menu is active.
 		mCamera.update(mHero->getPosition());
 	}
-	else if (mCreateTextPrompt == gameEvent.getType())
+	else if (Events::CreateTextPrompt == gameEvent.getType())
 	{
 		mDisableInput = true;
 
-		if (mSimulationMode)
-			mEventDialogManager.stop();
+		// ALW - Nothing else is simulated until the prompt is cleared, including the rest of this frame.
+		mScheduler.stop();
 	}
-	else if (mClearTextPrompt == gameEvent.getType())
+	else if (Events::ClearTextPrompt == gameEvent.getType())
 	{
 		mDisableInput = false;
 
@@ -171,41 +470,52 @@ void World::handleEvent(const trmb::Event &gameEvent)
 
 			if (!mDisplaySimulationFinishedEventDialog)
 			{
-				sendEvent(mBeginScoreboardEvent);
+				EventQueue::getInstance().post(Events::BeginScoreboard);
 			}
 		}
 	}
-	else if (mBeginSimulationEvent == gameEvent.getType())
+	else if (Events::BeginSimulation == gameEvent.getType())
 	{
 		mSimulationMode = true;
 		mMainTrackerUI.addInfectedResident(); // ALW - Track patient zero
+		mPreviewWorker.cancel();
+		buildFlowField();
 
 		calculateTotalScheduledEventDialogs();
 		mEventDialogManager.start();
+		mCollisionEvent = mScheduler.schedule(mTotalCollisionTime, std::bind(&World::updateCollisions, this));
 		mMusicPlayer.play(Music::ID::Krakatoa);
+
+		// ALW - Evaluated on the first tick of the night, once every mosquito has rolled its delay. The aggregate
+		// ALW - simulation is already an expectation, so there is nothing to compare it with.
+		if (!mAggregateMode)
+			mScheduler.schedule(sf::Time::Zero, std::bind(&World::evaluateExpectedNight, this));
 	}
-	else if (mSpawnMosquitoEvent == gameEvent.getType())
-	{
-		// ALW - Incidentally confirmed event is an EventStr. Downcasting is safe.
-		const trmb::EventStr &eventStr = static_cast<const trmb::EventStr &>(gameEvent);
-		assert(("The barrel ID is negative and cannot be converted to std::size_t!", 0 <= std::stoi(eventStr.getString())));
-		const std::size_t barrelID = std::stoi(eventStr.getString());
-		assert(("The barrel ID is out of range!", barrelID < mBarrels.size()));
-		mBarrelIDsToSpawnMosquito.push_back(barrelID);
-	}
-	else if (mBeginScoreboardEvent.getType() == gameEvent.getType())
+	else if (Events::BeginScoreboard == gameEvent.getType())
 	{
 		mSimulationMode = false;
 		mScoreboardUI.initialize(mMainTrackerUI.getResidentCount());
 	}
 }
 
+void World::handleEvent(const sf::Event &inputEvent)
+{
+	// ALW - Resolve what the click landed on before the Player turns it into a game event.
+	mMousePicker.handleEvent(inputEvent);
+
+	// ALW - Only Trambo's buttons still play through the trmb::SoundPlayer, and only when clicked, so its finished
+	// ALW - sounds are deleted before a click instead of every frame.
+	if (inputEvent.type == sf::Event::MouseButtonPressed)
+		mSoundPlayer.removeStoppedSounds();
+}
+
 void World::draw()
 {
 	mTarget.setView(mCamera.getView());
 	mTarget.draw(mSceneGraph);
 	mTarget.draw(mChatBoxUI);
 	mTarget.draw(mDaylightUI);
+	mTarget.draw(mPreviewUI);
 	mTarget.draw(mMainTrackerUI);
 	mTarget.draw(mScoreboardUI);
 }
@@ -283,10 +593,8 @@ bool World::existsWindowEventDialog() const
 	return !anyScreen || !anyClosed;
 }
 
-void World::updateScheduledEventDialog(sf::Time dt)
+void World::updateScheduledEventDialog()
 {
-	mEventDialogManager.update(dt);
-
 	if (mEventDialogManager.isReadyToDisplay())
 	{
 		if (mDisplayDoorEventDialog)
@@ -412,109 +720,81 @@ void World::displayWindowEventDialog()
 		mEventDialogManager.displayText(trmb::Localize::getInstance().getString("closedWindowEvent"));
 }
 
-void World::initializeDoorToHouseMap()
+void World::updateCollisions()
 {
-	std::set<trmb::SceneNode::Pair> collisionPairs;
-	mSceneLayers[DoorSelection]->checkSceneCollision(*mSceneLayers[HouseSelection], collisionPairs, true);
+	mCollisionEvent = mScheduler.schedule(mTotalCollisionTime, std::bind(&World::updateCollisions, this));
 
-	for (const auto &pair : collisionPairs)
+	if (mAggregateMode)
 	{
-		assert(("Dynamic cast failed.", dynamic_cast<DoorNode *>(pair.first) != nullptr));
-		assert(("Dynamic cast failed.", dynamic_cast<HouseNode *>(pair.second) != nullptr));
-
-		mDoorToHouse[static_cast<DoorNode *>(pair.first)] = static_cast<HouseNode *>(pair.second);
+		updateCompartmentalModel();
 	}
-}
-
-void World::initializeWindowToHouseMap()
-{
-	std::set<trmb::SceneNode::Pair> collisionPairs;
-	mSceneLayers[WindowSelection]->checkSceneCollision(*mSceneLayers[HouseSelection], collisionPairs, true);
-
-	for (const auto &pair : collisionPairs)
+	else
 	{
-		assert(("Dynamic cast failed.", dynamic_cast<WindowNode *>(pair.first) != nullptr));
-		assert(("Dynamic cast failed.", dynamic_cast<HouseNode *>(pair.second) != nullptr));
-
-		mWindowToHouse[static_cast<WindowNode *>(pair.first)] = static_cast<HouseNode *>(pair.second);
+		gatherActiveMosquitoes();
+		mosquitoResidentCollisions(); // ALW - Check residents before letting a mosquito exit the house.
+		mosquitoDoorCollisions();
+		mosquitoWindowCollisions();
 	}
-}
-
-void World::initializeResidentToHouseMap()
-{
-	std::set<trmb::SceneNode::Pair> collisionPairs;
-	mSceneLayers[Residents]->checkSceneCollision(*mSceneLayers[HouseSelection], collisionPairs, true);
-
-	for (const auto &pair : collisionPairs)
-	{
-		assert(("Dynamic cast failed.", dynamic_cast<ResidentNode *>(pair.first) != nullptr));
-		assert(("Dynamic cast failed.", dynamic_cast<HouseNode *>(pair.second) != nullptr));
 
-		mResidentToHouse[static_cast<ResidentNode *>(pair.first)] = static_cast<HouseNode *>(pair.second);
-	}
+	updateHouseTrackers();
 }
 
-void World::updateCollisions(sf::Time dt)
+void World::gatherActiveMosquitoes()
 {
-	mUpdateCollisionTime += dt;
+	mActiveMosquitoes.clear();
+	mActiveMosquitoes.insert(mActiveMosquitoes.end(), mMosquitoes.begin(), mMosquitoes.end());
 
-	if (mSimulationMode && mUpdateCollisionTime >= mTotalCollisionTime)
+	for (MosquitoNode * const mosquito : mMosquitoPool.getMosquitoes())
 	{
-		mUpdateCollisionTime -= mTotalCollisionTime;
-
-		mosquitoResidentCollisions(); // ALW - Check residents before letting a mosquito exit the house.
-		mosquitoDoorCollisions();
-		mosquitoWindowCollisions();
+		if (!mosquito->isDormant())
+			mActiveMosquitoes.push_back(mosquito);
 	}
 }
 
 void World::mosquitoDoorCollisions()
 {
-	std::set<trmb::SceneNode::Pair> collisionPairs;
-	mSceneLayers[Mosquitoes]->checkSceneCollision(*mSceneLayers[DoorSelection], collisionPairs, true);
+	const std::vector<InteractiveRegistry::Entity> &doors = mRegistry.getEntities(InteractiveRegistry::Kind::Door);
 
-	for (auto &pair : collisionPairs)
+	for (MosquitoNode * const mosquito : mActiveMosquitoes)
 	{
-		assert(("Dynamic cast failed.", dynamic_cast<MosquitoNode *>(pair.first) != nullptr));
-		MosquitoNode * const mosquito = static_cast<MosquitoNode *>(pair.first);
-
-		assert(("Dynamic cast failed.", dynamic_cast<DoorNode *>(pair.second) != nullptr));
-		DoorNode * const door = static_cast<DoorNode *>(pair.second);
-		assert(("The door key does not exist!", mDoorToHouse.count(door)));
-		std::map<DoorNode *, HouseNode *>::const_iterator found = mDoorToHouse.find(door);
-		HouseNode * const house = found->second;
+		// ALW - Like the scene collision check this replaced, every door is tested against where the mosquito
+		// ALW - was at the start of the pass.
+		const sf::FloatRect mosquitoRect = mosquito->getBoundingRect();
 
-		if (mosquito->isIndoor())
+		for (const InteractiveRegistry::Entity door : doors)
 		{
-			if (door->passThrough())
-			{
-				// ALW - Mosquito exits house
-				const float tileHeight = 64.0f;
-				const sf::Vector2f position = door->getPosition() + sf::Vector2f(0, tileHeight);
-				mosquito->setPosition(position); // ALW - Move mosquito one tile below the door
-				mosquito->setIndoor(false);
-				house->subtractMosquitoTotal();
-
-				if (mosquito->hasMalaria())
-					house->subtractInfectedMosquito();
-			}
-		}
-		else
-		{
-			if (door->passThrough())
-			{
-				// ALW - Mosquito enters house
-				mosquito->setPosition(house->getPosition());
-				mosquito->setIndoor(true);
-				house->addMosquitoTotal();
+			if (!mosquitoRect.intersects(mRegistry.getCollisionBox(door)))
+				continue;
+
+			const InteractiveRegistry::Entity house = mRegistry.getAttachedHouse(door);
+			const bool isDoorClosed = mRegistry.getPrevention(door).closed;
 
-				if (mosquito->hasMalaria())
-					house->addInfectedMosquito();
+			if (mosquito->isIndoor())
+			{
+				if (passThroughDoor(isDoorClosed))
+				{
+					// ALW - Mosquito exits house
+					const float tileHeight = 64.0f;
+					const sf::Vector2f position = mRegistry.getTransform(door) + sf::Vector2f(0, tileHeight);
+					mosquito->setPosition(position); // ALW - Move mosquito one tile below the door
+					mosquito->setIndoor(false);
+					mRegistry.removeIndoorMosquito(house, mosquito->hasMalaria());
+				}
 			}
 			else
 			{
-				// ALW - Door deflects mosquito
-				mScoreboardUI.addDoorDeflection();
+				if (passThroughDoor(isDoorClosed))
+				{
+					// ALW - Mosquito enters house
+					mosquito->setPosition(mRegistry.getTransform(house));
+					mosquito->setIndoor(true);
+					mRegistry.addIndoorMosquito(house, mosquito->hasMalaria());
+				}
+				else
+				{
+					// ALW - Door deflects mosquito
+					mScoreboardUI.addDoorDeflection();
+				}
 			}
 		}
 	}
@@ -522,51 +802,46 @@ void World::mosquitoDoorCollisions()
 
 void World::mosquitoWindowCollisions()
 {
-	std::set<trmb::SceneNode::Pair> collisionPairs;
-	mSceneLayers[Mosquitoes]->checkSceneCollision(*mSceneLayers[WindowSelection], collisionPairs, true);
+	const std::vector<InteractiveRegistry::Entity> &windows = mRegistry.getEntities(InteractiveRegistry::Kind::Window);
 
-	for (auto &pair : collisionPairs)
+	for (MosquitoNode * const mosquito : mActiveMosquitoes)
 	{
-		assert(("Dynamic cast failed.", dynamic_cast<MosquitoNode *>(pair.first) != nullptr));
-		MosquitoNode * const mosquito = static_cast<MosquitoNode *>(pair.first);
+		const sf::FloatRect mosquitoRect = mosquito->getBoundingRect();
 
-		assert(("Dynamic cast failed.", dynamic_cast<WindowNode *>(pair.second) != nullptr));
-		WindowNode * const window = static_cast<WindowNode *>(pair.second);
-		assert(("The window key does not exist!", mWindowToHouse.count(window)));
-		std::map<WindowNode *, HouseNode *>::const_iterator found = mWindowToHouse.find(window);
-		HouseNode * const house = found->second;
-
-		if (mosquito->isIndoor())
-		{
-			if (window->passThrough())
-			{
-				// ALW - Mosquito exits house
-				const float tileHeight = 64.0f;
-				const sf::Vector2f position = window->getPosition() - sf::Vector2f(0, tileHeight);
-				mosquito->setPosition(position); // ALW - Move mosquito one tile above the window
-				mosquito->setIndoor(false);
-				house->subtractMosquitoTotal();
-
-				if (mosquito->hasMalaria())
-					house->subtractInfectedMosquito();
-			}
-		}
-		else
+		for (const InteractiveRegistry::Entity window : windows)
 		{
-			if (window->passThrough())
-			{
-				// ALW - Mosquito enters house
-				mosquito->setPosition(house->getPosition());
-				mosquito->setIndoor(true);
-				house->addMosquitoTotal();
+			if (!mosquitoRect.intersects(mRegistry.getCollisionBox(window)))
+				continue;
 
-				if (mosquito->hasMalaria())
-					house->addInfectedMosquito();
+			const InteractiveRegistry::Entity house = mRegistry.getAttachedHouse(window);
+			const InteractiveRegistry::Prevention &prevention = mRegistry.getPrevention(window);
+
+			if (mosquito->isIndoor())
+			{
+				if (passThroughWindow(prevention.closed, prevention.screened))
+				{
+					// ALW - Mosquito exits house
+					const float tileHeight = 64.0f;
+					const sf::Vector2f position = mRegistry.getTransform(window) - sf::Vector2f(0, tileHeight);
+					mosquito->setPosition(position); // ALW - Move mosquito one tile above the window
+					mosquito->setIndoor(false);
+					mRegistry.removeIndoorMosquito(house, mosquito->hasMalaria());
+				}
 			}
 			else
 			{
-				// ALW - Window deflects mosquito
-				mScoreboardUI.addWindowDeflection();
+				if (passThroughWindow(prevention.closed, prevention.screened))
+				{
+					// ALW - Mosquito enters house
+					mosquito->setPosition(mRegistry.getTransform(house));
+					mosquito->setIndoor(true);
+					mRegistry.addIndoorMosquito(house, mosquito->hasMalaria());
+				}
+				else
+				{
+					// ALW - Window deflects mosquito
+					mScoreboardUI.addWindowDeflection();
+				}
 			}
 		}
 	}
@@ -574,30 +849,41 @@ void World::mosquitoWindowCollisions()
 
 void World::mosquitoResidentCollisions()
 {
-	std::set<trmb::SceneNode::Pair> collisionPairs;
-	mSceneLayers[Mosquitoes]->checkSceneCollision(*mSceneLayers[Residents], collisionPairs, true);
+	const std::vector<InteractiveRegistry::Entity> &houses = mRegistry.getEntities(InteractiveRegistry::Kind::House);
 
-	for (auto &pair : collisionPairs)
+	for (MosquitoNode * const mosquito : mActiveMosquitoes)
 	{
-		assert(("Dynamic cast failed.", dynamic_cast<MosquitoNode *>(pair.first) != nullptr));
-		MosquitoNode * const mosquito = static_cast<MosquitoNode *>(pair.first);
+		if (!mosquito->isIndoor())
+			continue;
 
-		assert(("Dynamic cast failed.", dynamic_cast<ResidentNode *>(pair.second) != nullptr));
-		ResidentNode * const resident = static_cast<ResidentNode *>(pair.second);
-		assert(("The resident key does not exist!", mResidentToHouse.count(resident)));
-		std::map<ResidentNode *, HouseNode *>::const_iterator found = mResidentToHouse.find(resident);
-		HouseNode * const house = found->second;
+		const sf::FloatRect mosquitoRect = mosquito->getBoundingRect();
 
-		if (mosquito->isIndoor())
+		// ALW - Residents stay inside their house's collision box, so only the residents of a house the
+		// ALW - mosquito is in need to be checked.
+		for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
 		{
-			if (resident->isBitten(house->getTotalMintNets(), house->getTotalDamagedNets()))
+			const InteractiveRegistry::Entity house = houses[houseID];
+			if (!mosquitoRect.intersects(mRegistry.getCollisionBox(house)))
+				continue;
+
+			const InteractiveRegistry::Bednets &bednets = mRegistry.getBednets(house);
+
+			ResidentNode &residents = *mHouseResidents[houseID];
+
+			for (std::size_t resident = 0; resident < residents.getResidentCount(); ++resident)
 			{
-				if (mosquito->hasMalaria() && !resident->hasMalaria())
+				if (!mosquitoRect.intersects(residents.getBoundingRect(resident)))
+					continue;
+
+				if (residents.isBitten(resident, bednets.mint, bednets.damaged))
 				{
-					if (!resident->isCured(mClinic->getTotalRDTs(), mClinic->getTotalACTs()))
+					if (mosquito->hasMalaria() && !residents.hasMalaria(resident))
 					{
+						if (!residents.isCured(mClinic->getTotalRDTs(), mClinic->getTotalACTs()))
+						{
 							// ALW - Transmit malaria to resident
-							resident->contractMalaria();
+							residents.contractMalaria(resident);
+							mRegistry.addInfectedResident(house);
 							mMainTrackerUI.addInfectedResident();
 							mScoreboardUI.addInfectedResident();
 							++mTransmissionCount;
@@ -605,41 +891,306 @@ void World::mosquitoResidentCollisions()
 							if (isFirstTransmission())
 							{
 								mEventDialogManager.displayText(trmb::Localize::getInstance().getString("transmissionEvent"));
-								// ALW - This will ignore the rest of the collision pairs and potential malaria transmissions
+								// ALW - This will ignore the rest of the collisions and potential malaria transmissions
 								// ALW - for this pass only. This is done, so the user sees exactly one transmission when the
 								// ALW - transmission message appears. Otherwise, there may be multiple transmissions when the
 								// ALW - transmission message appears.
-								break;
+								return;
 							}
+						}
+						else
+						{
+							// ALW - RDT and ACT cures resident
+							mScoreboardUI.addCuredResident();
+						}
 					}
-					else
+					if (residents.hasMalaria(resident) && !mosquito->hasMalaria())
 					{
-						// ALW - RDT and ACT cures resident
-						mScoreboardUI.addCuredResident();
+						// ALW - Transmit malaria to mosquito
+						mosquito->contractMalaria();
+						mRegistry.addInfectedIndoorMosquito(house);
+						mMainTrackerUI.addInfectedMosquito();
 					}
 				}
-				if (resident->hasMalaria() && !mosquito->hasMalaria())
+				else
 				{
-					// ALW - Transmit malaria to mosquito
-					mosquito->contractMalaria();
-					house->addInfectedMosquito();
-					mMainTrackerUI.addInfectedMosquito();
+					// ALW - Net deflects mosquito
+					mScoreboardUI.addNetDeflection();
 				}
 			}
-			else
+		}
+	}
+}
+
+void World::updateHouseTrackers()
+{
+	const std::vector<InteractiveRegistry::Entity> &houses = mRegistry.getEntities(InteractiveRegistry::Kind::House);
+
+	// ALW - The collision passes only touch the registry. Each HouseTrackerUI that changed is updated once
+	// ALW - here, instead of once per mosquito that entered or left the house.
+	for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
+	{
+		const InteractiveRegistry::Tracker &tracker = mRegistry.getTracker(houses[houseID]);
+
+		if (tracker.dirty)
+		{
+			mHouses[houseID]->setMosquitoTotal(tracker.mosquitoTotal);
+			mHouses[houseID]->setInfectedMosquitoCount(tracker.infectedMosquitoes);
+			mRegistry.clearTrackerDirty(houses[houseID]);
+		}
+	}
+}
+
+void World::initializeCompartmentalModel()
+{
+	assert(("The model and the scene disagree on the number of houses!", mCompartmentalModel.getHouseCount() == mHouses.size()));
+
+	// ALW - The model identifies houses by the order they were built, which is the order of mHouses.
+	for (std::size_t houseID = 0; houseID < mHouseResidents.size(); ++houseID)
+	{
+		const ResidentNode &residents = *mHouseResidents[houseID];
+
+		for (std::size_t resident = 0; resident < residents.getResidentCount(); ++resident)
+		{
+			if (residents.hasMalaria(resident))
+				mCompartmentalModel.infectResident(houseID); // ALW - Patient zero
+		}
+	}
+
+	mCompartmentalModel.addMosquitoes(mMosquitoCount, mSpawnSampler);
+}
+
+void World::updateCompartmentalModel()
+{
+	// ALW - The player may have changed the prevention measures during build mode.
+	const std::vector<InteractiveRegistry::Entity> &doors = mRegistry.getEntities(InteractiveRegistry::Kind::Door);
+	for (std::size_t doorID = 0; doorID < doors.size(); ++doorID)
+		mCompartmentalModel.setDoorClosed(doorID, mRegistry.getPrevention(doors[doorID]).closed);
+
+	const std::vector<InteractiveRegistry::Entity> &windows = mRegistry.getEntities(InteractiveRegistry::Kind::Window);
+	for (std::size_t windowID = 0; windowID < windows.size(); ++windowID)
+	{
+		const InteractiveRegistry::Prevention &prevention = mRegistry.getPrevention(windows[windowID]);
+		mCompartmentalModel.setWindowState(windowID, prevention.closed, prevention.screened);
+	}
+
+	const std::vector<InteractiveRegistry::Entity> &houses = mRegistry.getEntities(InteractiveRegistry::Kind::House);
+	for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
+	{
+		const InteractiveRegistry::Bednets &bednets = mRegistry.getBednets(houses[houseID]);
+		mCompartmentalModel.setHouseNets(houseID, bednets.mint, bednets.damaged);
+	}
+
+	mCompartmentalModel.setClinicStock(mClinic->getTotalRDTs(), mClinic->getTotalACTs());
+	mCompartmentalModel.step();
+
+	updateAggregateTrackers();
+	updateAggregateScoreboard();
+	updateAggregateResidents();
+}
+
+void World::updateAggregateTrackers()
+{
+	// ALW - Round the totals first and clamp the infected counts to them, so a tracker never shows more
+	// ALW - infected mosquitoes than mosquitoes.
+	const int mosquitoTotal = static_cast<int>(std::floor(mCompartmentalModel.getMosquitoTotal() + 0.5f));
+	const int infectedMosquitoTotal = static_cast<int>(std::floor(mCompartmentalModel.getInfectedMosquitoTotal() + 0.5f));
+	mMainTrackerUI.setMosquitoCount(mosquitoTotal);
+	mMainTrackerUI.setInfectedMosquitoCount(std::min(infectedMosquitoTotal, mosquitoTotal));
+
+	// ALW - The HouseTrackerUIs are updated from the registry by updateHouseTrackers().
+	const std::vector<InteractiveRegistry::Entity> &houses = mRegistry.getEntities(InteractiveRegistry::Kind::House);
+	for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
+	{
+		const int indoorTotal = static_cast<int>(std::floor(mCompartmentalModel.getIndoorMosquitoes(houseID) + 0.5f));
+		const int indoorInfected = static_cast<int>(std::floor(mCompartmentalModel.getIndoorInfectedMosquitoes(houseID) + 0.5f));
+		mRegistry.setTracker(houses[houseID], indoorTotal, std::min(indoorInfected, indoorTotal));
+	}
+}
+
+void World::updateAggregateResidents()
+{
+	// ALW - The ResidentNodes show the model's infected residents per house, so the main tracker's infected
+	// ALW - residents always equals the sum of the houses.
+	const std::vector<InteractiveRegistry::Entity> &houses = mRegistry.getEntities(InteractiveRegistry::Kind::House);
+	for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
+	{
+		const int infected = static_cast<int>(std::floor(mCompartmentalModel.getInfectedResidents(houseID) + 0.5f));
+
+		ResidentNode &residents = *mHouseResidents[houseID];
+
+		for (std::size_t resident = 0; resident < residents.getResidentCount(); ++resident)
+		{
+			if (mRegistry.getResidents(houses[houseID]).infected >= infected)
+				break;
+
+			if (!residents.hasMalaria(resident))
 			{
-				// ALW - Net deflects mosquito
-				mScoreboardUI.addNetDeflection();
+				// ALW - Transmit malaria to resident
+				residents.contractMalaria(resident);
+				mRegistry.addInfectedResident(houses[houseID]);
+				mMainTrackerUI.addInfectedResident();
+				mScoreboardUI.addInfectedResident();
+				++mTransmissionCount;
+
+				if (isFirstTransmission())
+				{
+					// ALW - Same as the agent simulation, the player sees exactly one transmission when the
+					// ALW - transmission message appears. The rest are shown on the next step.
+					mEventDialogManager.displayText(trmb::Localize::getInstance().getString("transmissionEvent"));
+					return;
+				}
 			}
 		}
 	}
 }
 
+void World::updateAggregateScoreboard()
+{
+	// ALW - The model keeps fractional running totals. Only whole events are reported to the scoreboard.
+	for (; mReportedMosquitoSpawns < static_cast<int>(mCompartmentalModel.getMosquitoSpawns()); ++mReportedMosquitoSpawns)
+		mScoreboardUI.addMosquitoSpawn();
+
+	for (; mReportedDoorDeflections < static_cast<int>(mCompartmentalModel.getDoorDeflections()); ++mReportedDoorDeflections)
+		mScoreboardUI.addDoorDeflection();
+
+	for (; mReportedWindowDeflections < static_cast<int>(mCompartmentalModel.getWindowDeflections()); ++mReportedWindowDeflections)
+		mScoreboardUI.addWindowDeflection();
+
+	for (; mReportedNetDeflections < static_cast<int>(mCompartmentalModel.getNetDeflections()); ++mReportedNetDeflections)
+		mScoreboardUI.addNetDeflection();
+
+	for (; mReportedCuredResidents < static_cast<int>(mCompartmentalModel.getCuredResidents()); ++mReportedCuredResidents)
+		mScoreboardUI.addCuredResident();
+}
+
+void World::buildFlowField()
+{
+	mFlowField.build(mRegistry, getPreventions());
+}
+
+void World::buildNightLayout()
+{
+	std::vector<std::vector<sf::FloatRect>> residentRects;
+	residentRects.reserve(mHouseResidents.size());
+
+	// ALW - Residents do not move once they are placed in their house.
+	for (const ResidentNode * const residents : mHouseResidents)
+	{
+		residentRects.emplace_back();
+		for (std::size_t resident = 0; resident < residents->getResidentCount(); ++resident)
+			residentRects.back().push_back(residents->getBoundingRect(resident));
+	}
+
+	const sf::Time barrelSpawnDelay = mBarrels.empty() ? sf::Time::Zero : mBarrels.front()->getSpawnDelay();
+	mNightLayout = std::make_shared<NightLayout>(mSceneTemplate, mWorldBounds, barrelSpawnDelay, std::move(residentRects));
+}
+
+NightSimulation::State World::captureNightState() const
+{
+	NightSimulation::State state;
+	state.elapsed = sf::Time::Zero;
+	state.nightBegun = mSimulationMode;
+
+	const auto addMosquito = [&state](const MosquitoNode &mosquito)
+	{
+		const NightSimulation::Mosquito copy = { mosquito.getPosition(), mosquito.getRemainingDelay(), mosquito.hasMalaria()
+			, mosquito.isIndoor() };
+		state.mosquitoes.push_back(copy);
+	};
+
+	for (const MosquitoNode * const mosquito : mMosquitoes)
+		addMosquito(*mosquito);
+
+	for (const MosquitoNode * const mosquito : mMosquitoPool.getMosquitoes())
+	{
+		if (!mosquito->isDormant())
+			addMosquito(*mosquito);
+	}
+
+	for (InteractiveRegistry::Entity entity = 0; entity < mRegistry.getEntityCount(); ++entity)
+	{
+		state.preventions.push_back(mRegistry.getPrevention(entity));
+		state.bednets.push_back(mRegistry.getBednets(entity));
+	}
+
+	for (const ResidentNode * const residents : mHouseResidents)
+	{
+		state.infectedResidents.emplace_back();
+		for (std::size_t resident = 0; resident < residents->getResidentCount(); ++resident)
+			state.infectedResidents.back().push_back(residents->hasMalaria(resident));
+	}
+
+	for (const BarrelNode * const barrel : mBarrels)
+		state.barrelTimers.push_back(barrel->getSpawnTimer());
+
+	state.RDTs = mClinic->getTotalRDTs();
+	state.ACTs = mClinic->getTotalACTs();
+
+	state.mosquitoSpawns = 0;
+	state.transmissions = 0;
+	state.doorDeflections = 0;
+	state.windowDeflections = 0;
+	state.netDeflections = 0;
+	state.curedResidents = 0;
+
+	return state;
+}
+
+void World::evaluateExpectedNight()
+{
+	const NightSimulation::State state = captureNightState();
+	MarkovEvaluator evaluator(*mNightLayout);
+	const MarkovEvaluator::Expectation expectation = evaluator.evaluate(state, mEventDialogManager.getSimulationDuration());
+
+	// ALW - The scoreboard counts the residents infected before the night too, e.g. patient zero.
+	int infectedResidents = 0;
+	for (const std::vector<bool> &houseResidents : state.infectedResidents)
+		infectedResidents += static_cast<int>(std::count(houseResidents.begin(), houseResidents.end(), true));
+
+	mScoreboardUI.setExpectedResults(expectation.mosquitoSpawns, expectation.doorDeflections, expectation.windowDeflections
+		, expectation.netDeflections, expectation.curedResidents, infectedResidents + expectation.transmissions);
+}
+
+void World::updatePreview()
+{
+	// ALW - The aggregate simulation has no mosquitoes to copy, so only the agent simulation is previewed.
+	if (mSimulationMode || mAggregateMode || mPreviewUI.isHidden())
+		return;
+
+	// ALW - Every purchase changes the registry or the clinic's stock, so comparing them is enough to spot a new plan.
+	const std::size_t planRevision = mRegistry.getPlanRevision();
+	const int RDTs = mClinic->getTotalRDTs();
+	const int ACTs = mClinic->getTotalACTs();
+
+	if (mPreviewPlanRevision != planRevision || mPreviewRDTs != RDTs || mPreviewACTs != ACTs)
+	{
+		mPreviewPlanRevision = planRevision;
+		mPreviewRDTs = RDTs;
+		mPreviewACTs = ACTs;
+
+		mPreviewWorker.request(mNightLayout, captureNightState(), mEventDialogManager.getSimulationDuration());
+		mPreviewUI.setPending();
+	}
+
+	PreviewWorker::Estimate estimate;
+	if (mPreviewWorker.poll(estimate))
+		mPreviewUI.setEstimate(estimate.minInfections, estimate.maxInfections);
+}
+
 void World::spawnBarrelMosquitoes()
 {
-	for (const int barrelID : mBarrelIDsToSpawnMosquito)
+	for (const std::size_t barrelID : mBarrelIDsToSpawnMosquito)
 	{
-		const int numberOfMosquitoes = trmb::randomInt(2);
+		assert(("The barrel ID is out of range!", barrelID < mBarrels.size()));
+
+		if (mAggregateMode)
+		{
+			mCompartmentalModel.addBarrelSpawn(barrelID);
+			continue;
+		}
+
+		const int numberOfMosquitoes = SimulationRandom::getInstance().randomInt(2);
 		for (int i = 0; i < numberOfMosquitoes; ++i)
 		{
 			spawnBarrelMosquito(barrelID);
@@ -651,21 +1202,34 @@ void World::spawnBarrelMosquitoes()
 
 void World::spawnBarrelMosquito(std::size_t barrelID)
 {
-	mSceneLayers[Mosquitoes]->attachChild(std::move(std::unique_ptr<MosquitoNode>(new MosquitoNode(mTextures
-		, getRandomSpawnPositionNearBarrel(barrelID), true, mWorldBounds, *mSceneLayers[HouseSelection]))));
+	mMosquitoPool.acquire(getRandomSpawnPositionNearBarrel(barrelID));
+	mActiveMosquitoes.reserve(mMosquitoes.size() + mMosquitoPool.getMosquitoes().size());	// ALW - In case the pool grew
 	mMainTrackerUI.addMosquito();
 	mScoreboardUI.addMosquitoSpawn();
 }
 
+void World::dispatchEvents()
+{
+	// ALW - A handler can post more events, e.g. clearing the last prompt of the night begins the scoreboard. They are
+	// ALW - sent in the next batch, so no handler runs inside another.
+	while (EventQueue::getInstance().takeEvents(mDispatchedEvents))
+	{
+		for (const EventGuid type : mDispatchedEvents)
+			sendEvent(trmb::Event(type));
+
+		mDispatchedEvents.clear();
+	}
+}
+
 void World::updateSoundPlayer()
 {
-	// ALW - Delete sound effects that have finished playing.
-	mSoundPlayer.removeStoppedSounds();
+	// ALW - Start the sound effects requested this frame, once each.
+	mVoicePool.update();
 }
 
 void World::configureUIs()
 {
-	// ALW - Must occur after World::buildScene(), otherwise the Nodes will miss the mCreateTextPrompt event.
+	// ALW - Must occur after World::buildScene(), otherwise the Nodes will miss the Events::CreateTextPrompt event.
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("greeting"), true);
 
 	const unsigned int characterSize = 13;
@@ -712,110 +1276,118 @@ void World::buildScene()
 	// Initialize the different layers
 	for (std::size_t i = 0; i < LayerCount; ++i)
 	{
-		trmb::SceneNode::Ptr layer(new trmb::SceneNode());
-		mSceneLayers[i] = layer.get();
+		trmb::SceneNode::Ptr layer;
+		mCulledLayers[i] = nullptr;
 
+		// ALW - The layers with a node per object or mosquito only draw what is in view.
+		switch (i)
+		{
+		case ClinicSelection:
+		case DoorSelection:
+		case HouseSelection:
+		case WindowSelection:
+		case Selection:
+		case Mosquitoes:
+			mCulledLayers[i] = new CulledLayerNode(mWorldBounds);
+			layer.reset(mCulledLayers[i]);
+			break;
+		default:
+			layer.reset(new trmb::SceneNode());
+			break;
+		}
+
+		mSceneLayers[i] = layer.get();
 		mSceneGraph.attachChild(std::move(layer));
 	}
 
 	// Add tiled background
-	std::unique_ptr<trmb::MapLayerNode> layer0(new trmb::MapLayerNode(mMap, 0));
+	std::unique_ptr<trmb::MapLayerNode> layer0(new trmb::MapLayerNode(*mMap, 0));
 	mSceneLayers[Background]->attachChild(std::move(layer0));
 
 	// Add tiled houses
-	std::unique_ptr<trmb::MapLayerNode> layer1(new trmb::MapLayerNode(mMap, 1));
+	std::unique_ptr<trmb::MapLayerNode> layer1(new trmb::MapLayerNode(*mMap, 1));
 	mSceneLayers[Background]->attachChild(std::move(layer1));
 
 	// Add tiled roofs
-	std::unique_ptr<trmb::MapLayerNode> layer2(new trmb::MapLayerNode(mMap, 2));
+	std::unique_ptr<trmb::MapLayerNode> layer2(new trmb::MapLayerNode(*mMap, 2));
 	mSceneLayers[Background]->attachChild(std::move(layer2));
 
 	// ALW - Add darkess
-	mSceneLayers[Sky]->attachChild(std::move(std::unique_ptr<Darkness>(new Darkness(mWindow))));
+	mSceneLayers[Sky]->attachChild(std::move(std::unique_ptr<Darkness>(new Darkness(mWindow, mScheduler))));
 
 	// ALW - Add sprite and logic nodes
-	std::vector<InteractiveObject>::const_iterator iter    = begin(mObjectGroups.getInteractiveGroup().getInteractiveObjects());
-	std::vector<InteractiveObject>::const_iterator iterEnd = end(mObjectGroups.getInteractiveGroup().getInteractiveObjects());
+	std::vector<InteractiveObject>::const_iterator iterBegin = begin(mObjectGroups->getInteractiveGroup().getInteractiveObjects());
+	std::vector<InteractiveObject>::const_iterator iter      = iterBegin;
+	std::vector<InteractiveObject>::const_iterator iterEnd   = end(mObjectGroups->getInteractiveGroup().getInteractiveObjects());
 
 	// ALW - What house will start with an infected resident?
 	std::string infectHouse = getRandomHouseName(getHouseCount());
 
-	int barrelID = 0;
+	// ALW - The beds, residents, and prevention sprites of every object are baked into one batch.
+	std::unique_ptr<InteriorBatch> interiorBatch(new InteriorBatch(mObjectGroups->getInteractiveGroup(), mRegistry
+		, mTextures.get(Textures::ID::Tiles)));
+
+	std::size_t barrelID = 0;
 
 	for (; iter != iterEnd; ++iter)
 	{
+		// ALW - The registry's entities are the interactive objects in the order they were read.
+		const InteractiveRegistry::Entity entity = iter - iterBegin;
+
 		if (iter->getType() == "Barrel")
 		{
-			mSceneLayers[Update]->attachChild(std::move(std::unique_ptr<BarrelUpdateNode>(
-				new BarrelUpdateNode(*iter, mTextures.get(Textures::ID::Tiles)))));
-
-			std::unique_ptr<BarrelNode> barrel(new BarrelNode(*iter, mWindow, mCamera.getView(), mUIBundle, barrelID, mTextures
-				, mSoundPlayer, mDaylightUI, mChatBoxUI));
+			std::unique_ptr<BarrelNode> barrel(new BarrelNode(*iter, mWindow, mCamera.getView(), mUIBundle, mMousePicker, mRegistry, entity
+				, barrelID, mBarrelIDsToSpawnMosquito, mTextures, mDaylightUI, mChatBoxUI, mScheduler, mVoicePool));
 			mBarrels.push_back(barrel.get());
-			mSceneLayers[Selection]->attachChild(std::move(barrel));
+			mCulledLayers[Selection]->attachCulledChild(std::move(barrel), mRegistry.getBounds(entity));
 			++barrelID;
 		}
 		else if (iter->getType() == "Door")
 		{
-			mSceneLayers[Update]->attachChild(std::move(std::unique_ptr<DoorUpdateNode>(
-				new DoorUpdateNode(*iter, mTextures.get(Textures::ID::Tiles)))));
-
-			std::unique_ptr<DoorNode> door(new DoorNode(*iter, mWindow, mCamera.getView(), mUIBundle, mTextures, mSoundPlayer
-				, mDaylightUI, mChatBoxUI));
+			std::unique_ptr<DoorNode> door(new DoorNode(*iter, mWindow, mCamera.getView(), mUIBundle, mMousePicker, mRegistry, entity
+				, mTextures, mDaylightUI, mChatBoxUI, mVoicePool));
 			mDoors.emplace_back(door.get());
-			mSceneLayers[DoorSelection]->attachChild(std::move(door));
+			mCulledLayers[DoorSelection]->attachCulledChild(std::move(door), mRegistry.getBounds(entity));
 		}
 		else if (iter->getType() == "Window")
 		{
-			mSceneLayers[Update]->attachChild(std::move(std::unique_ptr<WindowUpdateNode>(
-				new WindowUpdateNode(*iter, mTextures.get(Textures::ID::Tiles)))));
-
-			std::unique_ptr<WindowNode> window(new WindowNode(*iter, mWindow, mCamera.getView(), mUIBundle, mTextures, mSoundPlayer
-				, mDaylightUI, mChatBoxUI));
+			std::unique_ptr<WindowNode> window(new WindowNode(*iter, mWindow, mCamera.getView(), mUIBundle, mMousePicker, mRegistry, entity
+				, mTextures, mDaylightUI, mChatBoxUI, mVoicePool));
 			mWindows.emplace_back(window.get());
-			mSceneLayers[WindowSelection]->attachChild(std::move(window));
+			mCulledLayers[WindowSelection]->attachCulledChild(std::move(window), mRegistry.getBounds(entity));
 		}
 		else if (iter->getType() == "Clinic")
 		{
 			assert(("There can only be one clinic!", ++mClinicCount == 1));
 
-			mSceneLayers[Update]->attachChild(std::move(std::unique_ptr<ClinicUpdateNode>(
-				new ClinicUpdateNode(*iter, mTextures.get(Textures::ID::Tiles)))));
-
-			std::unique_ptr<ClinicNode> clinic(new ClinicNode(*iter, mWindow, mCamera.getView(), mUIBundle, buildAttachedRects(*iter)
-				, mTextures, mSoundPlayer, mDaylightUI, mChatBoxUI));
+			std::unique_ptr<ClinicNode> clinic(new ClinicNode(*iter, mWindow, mCamera.getView(), mUIBundle, mMousePicker, mRegistry, entity
+				, mTextures, mDaylightUI, mChatBoxUI, mVoicePool));
 			mClinic = clinic.get();
-			mSceneLayers[ClinicSelection]->attachChild(std::move(clinic));
+			mCulledLayers[ClinicSelection]->attachCulledChild(std::move(clinic), mRegistry.getBounds(entity));
 		}
 		else if (iter->getType() == "House")
 		{
-			std::unique_ptr<HouseNode> house(
-				new HouseNode(*iter, mWindow, mCamera.getView(), mUIBundle, buildAttachedRects(*iter), mFonts, mSoundPlayer));
+			std::unique_ptr<HouseNode> house(new HouseNode(*iter, mWindow, mCamera.getView(), mUIBundle, mMousePicker, mRegistry, entity
+				, mFonts, mSoundPlayer, mVoicePool));
 			mHouses.emplace_back(house.get());
 
-			bool houseMatch = false;
-			int infectResident = 0;
+			std::size_t infectResident = ResidentNode::noResident;
 			if (infectHouse == iter->getName())
-			{
-				houseMatch = true;
-				infectResident = trmb::randomInt(iter->getResidents()); // ALW - Randomly select resident to infect
-			}
+				infectResident = SimulationRandom::getInstance().randomInt(iter->getResidents()); // ALW - Randomly select resident to infect
 
 			const int totalResidents = iter->getResidents();
 			assert(("There are not enough beds for the residents (two per bed)!", (totalResidents / 2.0f) <= iter->getBeds()));
-			for (int i = 0; i < totalResidents; ++i)
-			{
-				bool infect = false;
-				if (houseMatch && infectResident == i)
-					infect = true;
 
-				mSceneLayers[Update]->attachChild(std::move(std::unique_ptr<ResidentUpdateNode>(new ResidentUpdateNode(i, house.get()))));
-				mSceneLayers[Residents]->attachChild(std::move(std::unique_ptr<ResidentNode>(new ResidentNode(i, infect, house.get()))));
-				++mResidentCount;
-			}
+			std::unique_ptr<ResidentNode> residents(new ResidentNode(house.get(), totalResidents, infectResident, *interiorBatch
+				, entity));
+			mHouseResidents.push_back(residents.get());
+			mSceneLayers[Residents]->attachChild(std::move(residents));
+			mResidentCount += totalResidents;
+
+			if (ResidentNode::noResident != infectResident)
+				mRegistry.addInfectedResident(entity);
 
-			mSceneLayers[Update]->attachChild(std::move(std::unique_ptr<HouseUpdateNode>(new HouseUpdateNode(*iter))));
-			mSceneLayers[HouseSelection]->attachChild(std::move(house));
+			mCulledLayers[HouseSelection]->attachCulledChild(std::move(house), mRegistry.getBounds(entity));
 		}
 		else
 		{
@@ -824,11 +1396,40 @@ void World::buildScene()
 		}
 	}
 
-	// ALW - Add mosquitoes
-	for (int i = 0; i < mMosquitoCount; ++i)
+	if (mClinic)
+		interiorBatch->setClinic(*mClinic);
+	mSceneLayers[Update]->attachChild(std::move(interiorBatch));
+
+	// ALW - Add mosquitoes. In aggregate mode the CompartmentalModel tracks them instead.
 	{
-		mSceneLayers[Mosquitoes]->attachChild(std::move(std::unique_ptr<MosquitoNode>(new MosquitoNode(mTextures
-			, getRandomSpawnPosition(), false, mWorldBounds, *mSceneLayers[HouseSelection]))));
+		MemoryTracker::Scope scope(MemoryTracker::Mosquitoes);
+		std::vector<sf::Vector2f> spawnPositions;
+		if (!mAggregateMode)
+			mSpawnSampler.sample(mMosquitoCount, SimulationRandom::getInstance().getGenerator(), spawnPositions);
+
+		for (const sf::Vector2f spawnPosition : spawnPositions)
+		{
+			std::unique_ptr<MosquitoNode> mosquito(new MosquitoNode(mTextures, spawnPosition, false, mWorldBounds
+				, mHouseTileMask, mFlowField, mScheduler, mSwarmClock));
+			mMosquitoes.push_back(mosquito.get());
+			mCulledLayers[Mosquitoes]->attachMovingChild(std::move(mosquito));
+		}
+
+		// ALW - Preallocate the mosquitoes the barrels can spawn in one night. An uncovered barrel spawns at most
+		// ALW - one mosquito per spawn delay. The pool grows if the night runs long, which shows in its statistics.
+		std::size_t poolCapacity = 0;
+		if (!mAggregateMode && !mBarrels.empty())
+		{
+			const float spawnsPerBarrel = mEventDialogManager.getSimulationDuration().asSeconds()
+				/ mBarrels.front()->getSpawnDelay().asSeconds();
+			poolCapacity = mBarrels.size() * (static_cast<std::size_t>(spawnsPerBarrel) + 1);
+		}
+		mMosquitoPool.initialize(*mCulledLayers[Mosquitoes], poolCapacity);
+
+		// ALW - A barrel queues one spawn per spawn delay and the queue is emptied every frame, so neither of these
+		// ALW - grows during the night unless the pool does.
+		mBarrelIDsToSpawnMosquito.reserve(mBarrels.size());
+		mActiveMosquitoes.reserve(mMosquitoes.size() + mMosquitoPool.getMosquitoes().size());
 	}
 
 	// Add UIs
@@ -845,49 +1446,25 @@ void World::buildScene()
 	mSceneLayers[Camera]->attachChild(std::move(player));
 }
 
-std::vector<sf::FloatRect> World::buildAttachedRects(const InteractiveObject &interactiveObj)
-{
-	std::vector<InteractiveObject>::const_iterator iter    = begin(mObjectGroups.getInteractiveGroup().getInteractiveObjects());
-	std::vector<InteractiveObject>::const_iterator iterEnd = end(mObjectGroups.getInteractiveGroup().getInteractiveObjects());
-	std::vector<sf::FloatRect> attachedRects;
-
-	// ALW - Store all the rects of objects (windows, doors, etc) with the house they are attached to. Later
-	// ALW - the HouseNode object can use these rects to detect whether it is clicked or an attached object is.
-	for (; iter != iterEnd; ++iter)
-	{
-		if (interactiveObj.getName() == iter->getAttachedTo())
-			attachedRects.emplace_back(sf::FloatRect(iter->getX(), iter->getY(), iter->getWidth(), iter->getHeight()));
-	}
-
-	return attachedRects;
-}
-
-void World::generateSpawnPositions()
+std::vector<InteractiveRegistry::Prevention> World::getPreventions() const
 {
-	// ALW - Width and height of map
-	const int maxTilesWide = mObjectGroups.getInteractiveGroup().getWidth();
-	const int maxTilesHigh = mObjectGroups.getInteractiveGroup().getHeight();
+	std::vector<InteractiveRegistry::Prevention> preventions;
+	preventions.reserve(mRegistry.getEntityCount());
 
-	const float tileWidth = 64;
-	const float tileHeight = 64;
+	for (InteractiveRegistry::Entity entity = 0; entity < mRegistry.getEntityCount(); ++entity)
+		preventions.push_back(mRegistry.getPrevention(entity));
 
-	for (int column = 0; column < maxTilesWide; ++column)
-	{
-		for (int row = 0; row < maxTilesHigh; ++row)
-		{
-			mSpawnPositions.emplace_back(sf::Vector2f(column * tileWidth, row * tileHeight));
-		}
-	}
+	return preventions;
 }
 
-sf::Vector2f World::getRandomSpawnPosition() const
+void World::buildSpawnSampler()
 {
-	return mSpawnPositions.at(trmb::randomInt(mMap.getWidth() * mMap.getHeight()));
+	mSpawnSampler.build(mRegistry, getPreventions());
 }
 
 std::string World::getRandomHouseName(int exlusiveMax) const
 {
-	const int houseNumber = trmb::randomInt(exlusiveMax);
+	const int houseNumber = SimulationRandom::getInstance().randomInt(exlusiveMax);
 
 	return "House " + std::to_string(houseNumber);
 }
@@ -898,7 +1475,7 @@ sf::Vector2f World::getRandomSpawnPositionNearBarrel(std::size_t barrelID) const
 	const float tileHeight = 64;
 	const sf::FloatRect barrelRect = mBarrels.at(barrelID)->getBoundingRect();
 	const sf::Vector2f barrelPosition = sf::Vector2f(barrelRect.left, barrelRect.top);
-	const int direction = trmb::randomInt(Direction::Count);
+	const int direction = SimulationRandom::getInstance().randomInt(Direction::Count);
 	sf::Vector2f position;
 
 	switch (direction)
@@ -917,14 +1494,15 @@ sf::Vector2f World::getRandomSpawnPositionNearBarrel(std::size_t barrelID) const
 		break;
 	}
 
-	return position;
+	// ALW - A barrel on the edge of the map spawns onto its own tile instead of off the map.
+	return SpawnSampler::clamp(position, mWorldBounds);
 }
 
 int World::getHouseCount() const
 {
 	int count = 0;
-	std::vector<InteractiveObject>::const_iterator iter = begin(mObjectGroups.getInteractiveGroup().getInteractiveObjects());
-	std::vector<InteractiveObject>::const_iterator iterEnd = end(mObjectGroups.getInteractiveGroup().getInteractiveObjects());
+	std::vector<InteractiveObject>::const_iterator iter = begin(mObjectGroups->getInteractiveGroup().getInteractiveObjects());
+	std::vector<InteractiveObject>::const_iterator iterEnd = end(mObjectGroups->getInteractiveGroup().getInteractiveObjects());
 
 	for (; iter != iterEnd; ++iter)
 	{
@@ -6,11 +6,24 @@
 #include "../HUD/daylightUI.h"
 #include "../HUD/mainTrackerUI.h"
 #include "../HUD/optionsUI.h"
+#include "../HUD/previewUI.h"
 #include "../HUD/scoreboardUI.h"
 #include "../HUD/uiBundle.h"
 #include "../HUD/undoUI.h"
 #include "../EventDialog/eventDialogManager.h"
+#include "../GameObjects/flowField.h"
+#include "../GameObjects/houseTileMask.h"
+#include "../GameObjects/interactiveRegistry.h"
 #include "../GameObjects/objectGroups.h"
+#include "../GameObjects/sceneTemplate.h"
+#include "../GameObjects/spawnSampler.h"
+#include "../Player/mousePicker.h"
+#include "../SceneNodes/mosquitoPool.h"
+#include "../SceneNodes/swarmClock.h"
+#include "../Simulation/compartmentalModel.h"
+#include "../Simulation/eventScheduler.h"
+#include "../Simulation/nightSimulation.h"
+#include "../Simulation/previewWorker.h"
 
 #include "Trambo/Camera/camera.h"
 #include "Trambo/Events/event.h"
@@ -19,12 +32,14 @@
 #include "Trambo/SceneNodes/sceneNode.h"
 #include "Trambo/Tiles/map.h"
 
+#include <SFML/Config.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -32,6 +47,7 @@
 
 namespace sf
 {
+	class Event;
 	class RenderTarget;
 	class RenderWindow;
 }
@@ -45,23 +61,33 @@ namespace trmb
 class HeroNode;
 class BarrelNode;
 class ClinicNode;
+class CulledLayerNode;
 class DoorNode;
 class HouseNode;
+class MosquitoNode;
 class ResidentNode;
+class Snapshot;
+class VoicePool;
 class WindowNode;
 
 class World : public trmb::EventHandler
 {
 public:
 										World(sf::RenderWindow &window, trmb::FontHolder &fonts, trmb::SoundPlayer &soundPlayer
-											, trmb::MusicPlayer &MusicPlayer);
+											, trmb::MusicPlayer &MusicPlayer, VoicePool &voicePool);
 										World(const World &) = delete;
 	World &								operator=(const World &) = delete;
+										~World();
 
 	bool								isScoreboardFinished() const;
 
+	bool								saveSnapshot(const std::string &filename) const;
+	bool								loadSnapshot(const std::string &filename);
+	std::vector<NightSimulation::State>	forkNight(const std::vector<NightSimulation::Fork> &forks, sf::Time duration) const;
+
 	void								update(sf::Time dt);
 	virtual void						handleEvent(const trmb::Event &gameEvent);
+	void								handleEvent(const sf::Event &inputEvent);
 	void								draw();
 
 
@@ -88,31 +114,45 @@ private:
 	bool								existsHouseEventDialog() const;
 	bool								existsWindowEventDialog() const;
 
-	void								updateScheduledEventDialog(sf::Time dt);
+	void								updateScheduledEventDialog();
 	void								calculateTotalScheduledEventDialogs();
 	void								displayClinicEventDialog();
 	void								displayDoorEventDialog();
 	void								displayHouseEventDialog();
 	void								displayWindowEventDialog();
 
-	void								initializeDoorToHouseMap();
-	void								initializeWindowToHouseMap();
-	void								initializeResidentToHouseMap();
-
-	void								updateCollisions(sf::Time dt);
+	void								updateCollisions();
+	void								gatherActiveMosquitoes();
 	void								mosquitoDoorCollisions();
 	void								mosquitoWindowCollisions();
 	void								mosquitoResidentCollisions();
+	void								updateHouseTrackers();
+
+	void								initializeCompartmentalModel();
+	void								updateCompartmentalModel();
+	void								updateAggregateTrackers();
+	void								updateAggregateResidents();
+	void								updateAggregateScoreboard();
+
+	void								writeSnapshot(Snapshot &snapshot) const;
+	bool								readSnapshotHeader(Snapshot &snapshot) const;	// ALW - False if it cannot be restored here
+	void								readSnapshotBody(Snapshot &snapshot);			// ALW - Throws std::runtime_error on bad input
+
+	void								buildFlowField();
+	void								buildNightLayout();
+	NightSimulation::State				captureNightState() const;
+	void								evaluateExpectedNight();
+	void								updatePreview();
 
 	void								spawnBarrelMosquitoes();
 	void								spawnBarrelMosquito(std::size_t barrelID);
 
+	void								dispatchEvents();
 	void								updateSoundPlayer();
 	void								configureUIs();
 	void								buildScene();
-	std::vector<sf::FloatRect>			buildAttachedRects(const InteractiveObject &interactiveObj);
-	void								generateSpawnPositions();
-	sf::Vector2f						getRandomSpawnPosition() const;
+	std::vector<InteractiveRegistry::Prevention>	getPreventions() const;
+	void								buildSpawnSampler();
 	sf::Vector2f						getRandomSpawnPositionNearBarrel(std::size_t barrelID) const;
 	std::string							getRandomHouseName(int exlusiveMax) const;
 	int									getHouseCount() const;
@@ -138,26 +178,27 @@ private:
 
 
 private:
-	const trmb::Event							mBeginScoreboardEvent;   // ALW - Is sent from here.
-	const EventGuid								mFullscreen;			 // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid								mWindowed;				 // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid								mCreateTextPrompt;		 // ALW - Matches the GUID in the ChatBoxUI class.
-	const EventGuid								mClearTextPrompt;		 // ALW - Matches the GUID in the ChatBoxUI class.
-	const EventGuid								mBeginSimulationEvent;   // ALW - Matches the GUID in the DaylightUI class.
-	const EventGuid								mSpawnMosquitoEvent;	 // ALW - matches the GUID in the BarrelNode class.
-
 	const sf::RenderWindow						&mWindow;
 	sf::RenderTarget							&mTarget;
 	trmb::FontHolder							&mFonts;
 	trmb::SoundPlayer							&mSoundPlayer;
 	trmb::MusicPlayer							&mMusicPlayer;
-	trmb::TextureHolder							mTextures;
+	VoicePool									&mVoicePool;					// ALW - Owned by the Application
+	const trmb::TextureHolder					&mTextures;						// ALW - Shared through the AssetCache
 	
 	trmb::SceneNode								mSceneGraph;
 	std::array<trmb::SceneNode *, LayerCount>	mSceneLayers;
-	ObjectGroups								mObjectGroups;
-
-	trmb::Map									mMap;
+	std::array<CulledLayerNode *, LayerCount>	mCulledLayers;					// ALW - nullptr for a layer that is always drawn whole
+	std::shared_ptr<const ObjectGroups>			mObjectGroups;					// ALW - Shared through the AssetCache
+	std::shared_ptr<const SceneTemplate>		mSceneTemplate;					// ALW - Shared through the AssetCache
+	const HouseTileMask							&mHouseTileMask;
+	InteractiveRegistry							mRegistry;						// ALW - Cloned from the scene template
+	FlowField									mFlowField;						// ALW - Rebuilt when the night begins, once the barrels are settled
+	CompartmentalModel							mCompartmentalModel;
+	EventScheduler								mScheduler;						// ALW - Only advances during the night while no prompt is active
+	SwarmClock									mSwarmClock;					// ALW - Advances with the scheduler
+
+	std::shared_ptr<trmb::Map>					mMap;							// ALW - Shared through the AssetCache
 	sf::FloatRect								mWorldBounds;
 	trmb::Camera								mCamera;
 	sf::Vector2f								mHeroPosition;
@@ -172,23 +213,26 @@ private:
 	UndoUI										mWindowUI;
 	OptionsUI									mClinicUI;
 	OptionsUI									mHouseUI;
+	MousePicker									mMousePicker;
 
-	std::vector<sf::Vector2f>					mSpawnPositions;
+	SpawnSampler								mSpawnSampler;
 
 	int											mMosquitoCount;
 	int											mResidentCount;
 
 	bool										mDisableInput;
 	bool										mSimulationMode;
-	sf::Time									mTotalCollisionTime;
-	sf::Time									mUpdateCollisionTime;
+	const sf::Time								mTotalCollisionTime;
+	EventScheduler::EventID						mCollisionEvent;
 	std::vector<std::size_t>					mBarrelIDsToSpawnMosquito;
 	std::vector<BarrelNode *>					mBarrels;
+	MosquitoPool								mMosquitoPool;
 	int											mClinicCount;					// ALW - Only allow one clinic
 	ClinicNode									*mClinic;
-	std::map<DoorNode *, HouseNode *>			mDoorToHouse;
-	std::map<WindowNode *, HouseNode *>			mWindowToHouse;
-	std::map<ResidentNode *, HouseNode *>		mResidentToHouse;
+	std::vector<MosquitoNode *>					mMosquitoes;					// ALW - Excludes the pooled barrel mosquitoes
+	std::vector<MosquitoNode *>					mActiveMosquitoes;				// ALW - Rebuilt every collision pass
+	std::vector<ResidentNode *>					mHouseResidents;				// ALW - Indexed in the same order as mHouses
+	std::vector<EventGuid>						mDispatchedEvents;				// ALW - The batch taken from the EventQueue
 
 	// ALW - Event Dialog
 	EventDialogManager							mEventDialogManager;
@@ -210,6 +254,29 @@ private:
 
 	// ALW - Scoreboard
 	ScoreboardUI								mScoreboardUI;
+
+	// ALW - Aggregate Simulation
+	const int									mMaxMosquitoNodes;				// ALW - Larger towns use the CompartmentalModel
+	const bool									mAggregateMode;					// ALW - Set by the map, or forced by a large MosquitoCount
+	int											mReportedMosquitoSpawns;
+	int											mReportedDoorDeflections;
+	int											mReportedWindowDeflections;
+	int											mReportedNetDeflections;
+	int											mReportedCuredResidents;
+
+	// ALW - Snapshot
+	const sf::Uint32							mSnapshotID;					// ALW - "MOKA" at the start of every snapshot
+	const sf::Uint32							mSnapshotVersion;
+
+	// ALW - Fork
+	std::shared_ptr<const NightLayout>			mNightLayout;					// ALW - Shared by every fork of the night
+
+	// ALW - Preview
+	PreviewUI									mPreviewUI;
+	PreviewWorker								mPreviewWorker;
+	std::size_t									mPreviewPlanRevision;			// ALW - The plan the last preview was requested for
+	int											mPreviewRDTs;
+	int											mPreviewACTs;
 };
 
 #endif
@@ -1,37 +1,30 @@
 #include "Controller.h"
+#include "../Application/eventIdentifiers.h"
 
 #include <SFML/Window/Event.hpp>
 
 
 Controller::Controller()
-: mUp(0x84b05719)
-, mDown(0xa95ea771)
-, mLeft(0x84e6c13c)
-, mRight(0x19e343e8)
-, mEnter(0xff349d1d)
-, mLeftClickPress(0x6955d309)
-, mLeftClickRelease(0x128b8b25)
-, mRightClick(0x3e6524cd)
 {
 	// ALW - Create a map of event guids and corresponding actions
-	mActionBindings.createAction(mUp);
-	mActionBindings.createAction(mDown);
-	mActionBindings.createAction(mLeft);
-	mActionBindings.createAction(mRight);
-	mActionBindings.createAction(mEnter);
-	mActionBindings.createAction(mLeftClickPress);
-	mActionBindings.createAction(mLeftClickRelease);
-	mActionBindings.createAction(mRightClick);
+	mActionBindings.createAction(Events::Up);
+	mActionBindings.createAction(Events::Down);
+	mActionBindings.createAction(Events::Left);
+	mActionBindings.createAction(Events::Right);
+	mActionBindings.createAction(Events::Enter);
+	mActionBindings.createAction(Events::LeftClickPress);
+	mActionBindings.createAction(Events::LeftClickRelease);
+	mActionBindings.createAction(Events::RightClick);
 
 	// ALW - Create a map of keyboard buttons and corresponding actions (default bindings)
-	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::W,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  mUp);
-	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::S,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  mDown);
-	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::A,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  mLeft);
-	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::D,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  mRight);
-	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::Return, trmb::KeyboardKeyAsButton::ButtonType::OnPress),   mEnter);
-	mActionBindings.assignMouseButtonAsButtonBinding(trmb::MouseButtonAsButton(sf::Mouse::Left,		 trmb::MouseButtonAsButton::ButtonType::OnPress),   mLeftClickPress);
-	mActionBindings.assignMouseButtonAsButtonBinding(trmb::MouseButtonAsButton(sf::Mouse::Left,		 trmb::MouseButtonAsButton::ButtonType::OnRelease), mLeftClickRelease);
-	mActionBindings.assignMouseButtonAsButtonBinding(trmb::MouseButtonAsButton(sf::Mouse::Right,     trmb::MouseButtonAsButton::ButtonType::OnPress),   mRightClick);
+	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::W,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  Events::Up);
+	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::S,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  Events::Down);
+	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::A,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  Events::Left);
+	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::D,      trmb::KeyboardKeyAsButton::ButtonType::RealTime),  Events::Right);
+	mActionBindings.assignKeyboardKeyAsButtonBinding(trmb::KeyboardKeyAsButton(sf::Keyboard::Return, trmb::KeyboardKeyAsButton::ButtonType::OnPress),   Events::Enter);
+	mActionBindings.assignMouseButtonAsButtonBinding(trmb::MouseButtonAsButton(sf::Mouse::Left,		 trmb::MouseButtonAsButton::ButtonType::OnPress),   Events::LeftClickPress);
+	mActionBindings.assignMouseButtonAsButtonBinding(trmb::MouseButtonAsButton(sf::Mouse::Left,		 trmb::MouseButtonAsButton::ButtonType::OnRelease), Events::LeftClickRelease);
+	mActionBindings.assignMouseButtonAsButtonBinding(trmb::MouseButtonAsButton(sf::Mouse::Right,     trmb::MouseButtonAsButton::ButtonType::OnPress),   Events::RightClick);
 }
 
 const std::vector<trmb::ActionBinding::ActionSharedPtr> & Controller::getActions() const
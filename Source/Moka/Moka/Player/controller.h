@@ -49,17 +49,6 @@ public:
 	void					assignMouseButtonAsButtonBinding(const trmb::MouseButtonAsButton &MouseButtonAsButton, EventGuid eventGuid);
 
 
-private:
-	const EventGuid	mUp;
-	const EventGuid	mDown;
-	const EventGuid	mLeft;
-	const EventGuid	mRight;
-	const EventGuid mEnter;
-	const EventGuid	mLeftClickPress;
-	const EventGuid	mLeftClickRelease;
-	const EventGuid	mRightClick;
-
-
 private:
 	trmb::ActionBinding						mActionBindings;
 };
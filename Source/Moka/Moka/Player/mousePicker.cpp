@@ -0,0 +1,174 @@
+#include "mousePicker.h"
+#include "../GameObjects/interactiveGroup.h"
+#include "../HUD/chatBoxUI.h"
+#include "../HUD/daylightUI.h"
+#include "../HUD/optionsUI.h"
+#include "../HUD/uiBundle.h"
+#include "../HUD/undoUI.h"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include <cassert>
+#include <cmath>
+
+
+MousePicker::MousePicker(const sf::RenderWindow &window, const sf::View &view, const UIBundle &uiBundle
+	, const InteractiveGroup &interactiveGroup, const InteractiveRegistry &registry)
+: mWindow(window)
+, mView(view)
+, mUIBundle(uiBundle)
+, mRegistry(registry)
+, mTilesWide(interactiveGroup.getWidth())
+, mTilesHigh(interactiveGroup.getHeight())
+, mTiles(mTilesWide * mTilesHigh)
+, mMousePosition()
+, mMouseOverUI()
+, mPickedEntity(InteractiveRegistry::noEntity)
+{
+	mMouseOverUI.fill(false);
+	build();
+}
+
+sf::Vector2f MousePicker::getMousePosition() const
+{
+	return mMousePosition;
+}
+
+bool MousePicker::isMouseOverUI(UI ui) const
+{
+	assert(("The UI is out of range!", ui != UI::Count));
+	return mMouseOverUI[static_cast<std::size_t>(ui)];
+}
+
+bool MousePicker::isMouseOverInputUI() const
+{
+	return isMouseOverUI(UI::ChatBox) || isMouseOverUI(UI::Daylight);
+}
+
+InteractiveRegistry::Entity MousePicker::getPickedEntity() const
+{
+	return mPickedEntity;
+}
+
+bool MousePicker::isPicked(InteractiveRegistry::Kind kind) const
+{
+	return InteractiveRegistry::noEntity != mPickedEntity && kind == mRegistry.getKind(mPickedEntity);
+}
+
+void MousePicker::handleEvent(const sf::Event &inputEvent)
+{
+	// ALW - Must be called before the Player turns the click into a left click press event, so the result
+	// ALW - is ready when the InteractiveNodes handle it.
+	if (sf::Event::MouseButtonPressed == inputEvent.type && sf::Mouse::Left == inputEvent.mouseButton.button)
+		pick(sf::Vector2i(inputEvent.mouseButton.x, inputEvent.mouseButton.y));
+}
+
+void MousePicker::pick(sf::Vector2i relativeToWindow)
+{
+	mMousePosition = mWindow.mapPixelToCoords(relativeToWindow, mView);
+
+	bool mouseOverUI = false;
+	for (std::size_t i = 0; i < mMouseOverUI.size(); ++i)
+	{
+		// ALW - There are only a handful of UIs and they move whenever an object is selected, so they are
+		// ALW - tested directly instead of being kept in the grid.
+		mMouseOverUI[i] = getUIRect(static_cast<UI>(i)).contains(mMousePosition);
+		mouseOverUI = mouseOverUI || mMouseOverUI[i];
+	}
+
+	mPickedEntity = InteractiveRegistry::noEntity;
+	if (!mouseOverUI)
+		mPickedEntity = pickEntity();
+}
+
+sf::FloatRect MousePicker::getUIRect(UI ui) const
+{
+	sf::FloatRect rect;
+
+	switch (ui)
+	{
+	case UI::ChatBox:
+		rect = mUIBundle.getChatBoxUI().getRect();
+		break;
+	case UI::Daylight:
+		rect = mUIBundle.getDaylightUI().getRect();
+		break;
+	case UI::Barrel:
+		rect = mUIBundle.getBarrelUI().getRect();
+		break;
+	case UI::Door:
+		rect = mUIBundle.getDoorUI().getRect();
+		break;
+	case UI::Window:
+		rect = mUIBundle.getWindowUI().getRect();
+		break;
+	case UI::Clinic:
+		rect = mUIBundle.getClinicUI().getRect();
+		break;
+	case UI::House:
+		rect = mUIBundle.getHouseUI().getRect();
+		break;
+	default:
+		assert(("The UI is out of range!", false));
+	}
+
+	return rect;
+}
+
+InteractiveRegistry::Entity MousePicker::pickEntity() const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	const int column = static_cast<int>(std::floor(mMousePosition.x / tileWidth));
+	const int row = static_cast<int>(std::floor(mMousePosition.y / tileHeight));
+
+	if (column < 0 || mTilesWide <= column || row < 0 || mTilesHigh <= row)
+		return InteractiveRegistry::noEntity;
+
+	InteractiveRegistry::Entity building = InteractiveRegistry::noEntity;
+	for (const InteractiveRegistry::Entity entity : mTiles[row * mTilesWide + column])
+	{
+		if (!mRegistry.getBounds(entity).contains(mMousePosition))
+			continue;
+
+		const InteractiveRegistry::Kind kind = mRegistry.getKind(entity);
+		if (InteractiveRegistry::Kind::Clinic == kind || InteractiveRegistry::Kind::House == kind)
+		{
+			// ALW - Barrels, doors, and windows sit on top of the buildings they are attached to.
+			building = entity;
+		}
+		else
+			return entity;
+	}
+
+	return building;
+}
+
+void MousePicker::build()
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	for (InteractiveRegistry::Entity entity = 0; entity < mRegistry.getEntityCount(); ++entity)
+	{
+		if (InteractiveRegistry::Kind::Other == mRegistry.getKind(entity))
+			continue;
+
+		const sf::FloatRect bounds = mRegistry.getBounds(entity);
+
+		for (int row = 0; row < mTilesHigh; ++row)
+		{
+			for (int column = 0; column < mTilesWide; ++column)
+			{
+				const sf::FloatRect tileRect(column * tileWidth, row * tileHeight, tileWidth, tileHeight);
+
+				if (tileRect.intersects(bounds))
+					mTiles[row * mTilesWide + column].push_back(entity);
+			}
+		}
+	}
+}
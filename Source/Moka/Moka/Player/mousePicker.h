@@ -0,0 +1,81 @@
+#ifndef MOUSE_PICKER_H
+#define MOUSE_PICKER_H
+
+#include "../GameObjects/interactiveRegistry.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+	class Event;
+	class RenderWindow;
+	class View;
+}
+
+class InteractiveGroup;
+class UIBundle;
+
+// ALW - Works out what a left click landed on once, before the InteractiveNodes handle the click. The mouse
+// ALW - position is mapped to world coordinates a single time, tested against the UI rects, and then looked
+// ALW - up in a tile grid of the interactive objects' rects. The nodes only compare the result against
+// ALW - themselves, so the outcome no longer depends on the order they appear in the SceneNode.
+class MousePicker
+{
+public:
+	enum class UI
+	{
+		ChatBox,
+		Daylight,
+		Barrel,
+		Door,
+		Window,
+		Clinic,
+		House,
+		Count
+	};
+
+
+public:
+								MousePicker(const sf::RenderWindow &window, const sf::View &view, const UIBundle &uiBundle
+									, const InteractiveGroup &interactiveGroup, const InteractiveRegistry &registry);
+								MousePicker(const MousePicker &) = delete;
+	MousePicker &				operator=(const MousePicker &) = delete;
+
+	sf::Vector2f				getMousePosition() const;
+	bool						isMouseOverUI(UI ui) const;
+	bool						isMouseOverInputUI() const;		// ALW - The ChatBoxUI or DaylightUI, which take the click
+	InteractiveRegistry::Entity	getPickedEntity() const;
+	bool						isPicked(InteractiveRegistry::Kind kind) const;
+
+	void						handleEvent(const sf::Event &inputEvent);
+
+
+private:
+	void						pick(sf::Vector2i relativeToWindow);
+	sf::FloatRect				getUIRect(UI ui) const;
+	InteractiveRegistry::Entity	pickEntity() const;
+	void						build();
+
+
+private:
+	const sf::RenderWindow						&mWindow;
+	const sf::View								&mView;
+	const UIBundle								&mUIBundle;
+	const InteractiveRegistry					&mRegistry;
+
+	int											mTilesWide;
+	int											mTilesHigh;
+	std::vector<std::vector<InteractiveRegistry::Entity>>	mTiles;		// ALW - Entities whose rect overlaps each tile
+
+	sf::Vector2f								mMousePosition;
+	std::array<bool, static_cast<std::size_t>(UI::Count)>	mMouseOverUI;
+	InteractiveRegistry::Entity					mPickedEntity;
+};
+
+#endif
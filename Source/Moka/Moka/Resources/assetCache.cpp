@@ -0,0 +1,88 @@
+#include "assetCache.h"
+#include "../Application/memoryTracker.h"
+#include "../GameObjects/objectGroups.h"
+#include "../GameObjects/sceneTemplate.h"
+
+#include "Trambo/Tiles/map.h"
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cassert>
+
+
+AssetCache & AssetCache::getInstance()
+{
+	static AssetCache instance;
+	return instance;
+}
+
+AssetCache::AssetCache()
+: mTextures()
+, mTexturePaths()
+, mObjectGroups()
+, mMaps()
+, mSceneTemplates()
+{
+}
+
+trmb::TextureHolder & AssetCache::getTextures()
+{
+	return mTextures;
+}
+
+void AssetCache::loadTexture(Textures::ID id, const std::string &filename)
+{
+	const auto found = mTexturePaths.find(filename);
+	if (found != end(mTexturePaths))
+	{
+		assert(("The texture is already loaded under another ID!", found->second == id));
+		return;
+	}
+
+	// ALW - SFML keeps the pixels itself, so they never pass through operator new.
+	MemoryTracker::Scope scope(MemoryTracker::Textures);
+	mTextures.load(id, filename);
+	mTexturePaths.insert(std::make_pair(filename, id));
+
+	const sf::Vector2u size = mTextures.get(id).getSize();
+	MemoryTracker::recordExternal(MemoryTracker::Textures, size.x * size.y * 4u);
+}
+
+std::shared_ptr<const ObjectGroups> AssetCache::getObjectGroups(const std::string &filename)
+{
+	std::shared_ptr<const ObjectGroups> &objectGroups = mObjectGroups[filename];
+	if (!objectGroups)
+	{
+		MemoryTracker::Scope scope(MemoryTracker::Map);
+		objectGroups = std::make_shared<const ObjectGroups>(filename);
+	}
+
+	return objectGroups;
+}
+
+std::shared_ptr<trmb::Map> AssetCache::getMap(const std::string &filename)
+{
+	std::shared_ptr<trmb::Map> &map = mMaps[filename];
+	if (!map)
+	{
+		MemoryTracker::Scope scope(MemoryTracker::Map);
+		map = std::make_shared<trmb::Map>(filename);
+	}
+
+	return map;
+}
+
+std::shared_ptr<const SceneTemplate> AssetCache::getSceneTemplate(const std::string &filename)
+{
+	std::shared_ptr<const SceneTemplate> &sceneTemplate = mSceneTemplates[filename];
+	if (!sceneTemplate)
+	{
+		const std::shared_ptr<const ObjectGroups> objectGroups = getObjectGroups(filename);
+
+		MemoryTracker::Scope scope(MemoryTracker::Map);
+		sceneTemplate = std::make_shared<const SceneTemplate>(objectGroups->getInteractiveGroup());
+	}
+
+	return sceneTemplate;
+}
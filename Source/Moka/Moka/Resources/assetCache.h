@@ -0,0 +1,55 @@
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include "resourceIdentifiers.h"
+
+#include "Trambo/Resources/resourceHolder.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+
+class ObjectGroups;
+class SceneTemplate;
+
+namespace trmb
+{
+	class Map;
+}
+
+// ALW - Decoded assets shared by the Application and every World, keyed by path. The scoreboard clears the
+// ALW - GameState and the next World is built from scratch, so without the cache playing again would reload the
+// ALW - world textures from disk and parse the map twice more. Textures::ID is global, so one TextureHolder holds
+// ALW - the textures of every state. trmb::ResourceHolder cannot unload, so a texture stays decoded once loaded.
+// ALW - The map, its object groups, and its SceneTemplate are reference counted, and the cache keeps one reference
+// ALW - of its own so they outlive the World that first asked for them.
+class AssetCache
+{
+public:
+	static AssetCache &						getInstance();
+
+											AssetCache(const AssetCache &) = delete;
+	AssetCache &							operator=(const AssetCache &) = delete;
+
+	trmb::TextureHolder &					getTextures();
+	void									loadTexture(Textures::ID id, const std::string &filename);	// ALW - Does nothing if the path is loaded
+
+	std::shared_ptr<const ObjectGroups>		getObjectGroups(const std::string &filename);
+	std::shared_ptr<trmb::Map>				getMap(const std::string &filename);
+	std::shared_ptr<const SceneTemplate>	getSceneTemplate(const std::string &filename);	// ALW - Built from the map's object groups
+
+
+private:
+											AssetCache();
+
+
+private:
+	trmb::TextureHolder											mTextures;
+	std::map<std::string, Textures::ID>							mTexturePaths;
+	std::map<std::string, std::shared_ptr<const ObjectGroups>>	mObjectGroups;
+	std::map<std::string, std::shared_ptr<trmb::Map>>			mMaps;
+	std::map<std::string, std::shared_ptr<const SceneTemplate>>	mSceneTemplates;
+};
+
+#endif
@@ -41,6 +41,7 @@ namespace SoundEffects
 		Button,
 		Chat,
 		Object,
+		Count,		// ALW - The number of sound effects, not one of them
 	};
 }
 
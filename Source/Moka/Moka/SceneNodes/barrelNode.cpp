@@ -1,13 +1,16 @@
 #include "barrelNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/voicePool.h"
 #include "../GameObjects/interactiveObject.h"
 #include "../HUD/chatBoxUI.h"
 #include "../HUD/daylightUI.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/uiBundle.h"
+#include "../Player/mousePicker.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Localize/localize.h"
-#include "Trambo/Sounds/soundPlayer.h"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -17,90 +20,94 @@
 
 
 BarrelNode::BarrelNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window, const sf::View &view
-	, UIBundle &uiBundle, int barrelID, const trmb::TextureHolder &textures, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI
-	, ChatBoxUI &chatBoxUI)
-: PreventionNode(interactiveObject, window, view, uiBundle)
-, mBarrelUIActivated(0x10a1b42f)
-, mDrawBarrelUI(0xcfdb933d)
-, mDoNotDrawBarrelUI(0x210832f5)
-, mDrawBarrelSprite(0xe22f85d5, interactiveObject.getName())
-, mDoNotDrawBarrelSprite(0xcd1fd24, interactiveObject.getName())
-, mSpawnMosquitoEvent(0xbd01d8d, std::to_string(barrelID))
-, mLeftClickPress(0x6955d309)
-, mCreateTextPrompt(0x25e87fd8)
-, mClearTextPrompt(0xc1523265)
+	, UIBundle &uiBundle, const MousePicker &mousePicker, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+	, std::size_t barrelID, std::vector<std::size_t> &spawnQueue, const trmb::TextureHolder &textures
+	, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI, EventScheduler &scheduler, VoicePool &voicePool)
+: PreventionNode(interactiveObject, window, view, uiBundle, mousePicker, registry, entity)
 , mCoverCost(1.0f)
 , mTextures(textures)
-, mSoundPlayer(soundPlayer)
 , mDaylightUI(daylightUI)
 , mChatBoxUI(chatBoxUI)
-, mBarrelUIActive(false)
-, mIsBarrelCovered(false)
+, mScheduler(scheduler)
+, mVoicePool(voicePool)
+, mBarrelID(barrelID)
+, mSpawnQueue(spawnQueue)
 , mSpawnDelay(sf::seconds(5))
-, mSpawnTimer()
+, mSpawnEvent(EventScheduler::noEvent)
 {
 	mCallbackPairs.emplace_back(CallbackPair(std::bind(&BarrelNode::addCover, this), std::bind(&BarrelNode::undoCover, this)));
 	mUIElemStates.emplace_back(true);
 }
 
+bool BarrelNode::isBarrelCovered() const
+{
+	return mRegistry.getPrevention(mEntity).covered;
+}
+
+sf::Time BarrelNode::getSpawnDelay() const
+{
+	return mSpawnDelay;
+}
+
+sf::Time BarrelNode::getSpawnTimer() const
+{
+	if (!mScheduler.isPending(mSpawnEvent))
+		return sf::Time::Zero;
+
+	return mSpawnDelay - mScheduler.getTimeUntil(mSpawnEvent);
+}
+
 sf::FloatRect BarrelNode::getBoundingRect() const
 {
 	return sf::FloatRect(mInteractiveObject.getCollisionBoxXCoord(), mInteractiveObject.getCollisionBoxYCoord()
 		, mInteractiveObject.getCollisionBoxWidth(), mInteractiveObject.getCollisionBoxHeight());
 }
 
+void BarrelNode::save(Snapshot &snapshot) const
+{
+	mScheduler.save(snapshot, mSpawnEvent);
+}
+
+void BarrelNode::load(Snapshot &snapshot)
+{
+	mSpawnEvent = mScheduler.load(snapshot, mSpawnEvent, std::bind(&BarrelNode::spawnMosquito, this));
+}
+
 void BarrelNode::handleEvent(const trmb::Event &gameEvent)
 {
 	InteractiveNode::handleEvent(gameEvent);
 
+	// ALW - The cover cannot change once the simulation mode starts, so an uncovered barrel spawns for the rest of the night.
+	if (Events::BeginSimulation == gameEvent.getType() && !isBarrelCovered())
+		mSpawnEvent = mScheduler.schedule(mSpawnDelay, std::bind(&BarrelNode::spawnMosquito, this));
+
 	if (mDisableBuildMode)
 	{
 		mUIBundle.getBarrelUI().hide();
 	}
-	else if (!mDisableInput
-		  && !isMouseOverUI(mUIBundle.getChatBoxUI().getRect())
-		  && !isMouseOverUI(mUIBundle.getDaylightUI().getRect()))
+	else if (!mDisableInput && !mMousePicker.isMouseOverInputUI())
 	{
-		if (mBarrelUIActivated.getType() == gameEvent.getType())
-		{
-			// ALW - This is a workaround to fix an issue where an object had selection and then another object of the same
-			// ALW - type (barrel, door, window, clinic, house) was selected earlier in the SceneNode. What happened was
-			// ALW - the newly selected object would enable the UI, but then the previously selected object would disable the
-			// ALW - UI. This was not an issue in the reverse order. Now when an object is selected it sends a UI activated
-			// ALW - message, so an object later in the SceneNode knows not to disable the UI.
-			mBarrelUIActive = true;
-		}
-		else if (mLeftClickPress == gameEvent.getType())
+		if (Events::LeftClickPress == gameEvent.getType())
 		{
 			mPreviousSelectedState = mSelected;
-			if (mSelected && !isMouseOverUI(mUIBundle.getBarrelUI().getRect()))
+			if (mSelected && !mMousePicker.isMouseOverUI(MousePicker::UI::Barrel))
 			{
 				mSelected = false;
 			}
 
-			if (isMouseOverObject()
-				&& !isMouseOverUI(mUIBundle.getBarrelUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getDoorUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getWindowUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getClinicUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getHouseUI().getRect()))
+			// ALW - The MousePicker has already resolved which object, if any, the click landed on.
+			if (mMousePicker.getPickedEntity() == mEntity)
 			{
 				mSelected = true;
 				if (!mPreviousSelectedState)
 					activate();
 			}
 
-			if (mPreviousSelectedState && !mSelected && !mBarrelUIActive)
+			if (mPreviousSelectedState && !mSelected && !mMousePicker.isPicked(InteractiveRegistry::Kind::Barrel))
 			{
-				// ALW - Two scenarios are possible. First, an object earlier in the SceneNode is unselected. The UI
-				// ALW - will be hidden. This behavior is ok, because if an object later in the SceneNode
-				// ALW - is then selected it will unhide itself. Next, the object may be unselected, because the click
-				// ALW - did not occur on an object of the same type. Here the UI is not in use, so resetting and hiding
-				// ALW - the UI is the desired behavior.
+				// ALW - The click did not land on another barrel, so the UI is no longer in use.
 				mUIBundle.getBarrelUI().hide();
 			}
-
-			mBarrelUIActive = false;
 		}
 	}
 }
@@ -127,41 +134,16 @@ void BarrelNode::updateCurrent(sf::Time dt)
 
 		mUIBundle.getBarrelUI().handler(mWindow, mView, transform);
 	}
-
-	// ALW - Simulation Mode
-	if (mDisableBuildMode && !mIsBarrelCovered && !mDisableInput)
-	{
-		// ALW - The simulation mode has started, the barrel is not covered, and there isn't an interrupt prompt active.
-		mSpawnTimer += dt;
-		if (mSpawnTimer >= mSpawnDelay)
-		{
-			mSpawnTimer -= mSpawnDelay;
-			InteractiveNode::sendEvent(mSpawnMosquitoEvent);
-		}
-	}
 }
 
 void BarrelNode::activate()
 {
 	updateUndoUI();	
-	mSoundPlayer.play(SoundEffects::ID::Object);
-	InteractiveNode::sendEvent(mBarrelUIActivated);
-	// ALW - ChatBoxUI::UpdateText() can generate a mCreatePrompt event when an interactive object
-	// ALW - is selected. This asynchronous event will force InteractiveNode classes to ignore
-	// ALW - left and right click events. Then if <enter> is pressed an mEnter event will be
-	// ALW - generated allowing InteractiveNode classes to handle left and right click events.
-	// ALW - However, if another interactive object is selected that occurs before the currently
-	// ALW - selected interactive object in the SceneNode then this newly selected interactive
-	// ALW - object will cause ChatBoxUI::UpdateText() to be called which generates a mCreatePrompt.
-	// ALW - InteractiveNodes are then forced to ignore left and right click events, so the original
-	// ALW - interactive object will be left selected. To remedy this all InteractiveNodes deselect
-	// ALW - themselves when a mCreatePrompt is generated. Immediately afterwards the InteractiveNode
-	// ALW - that generated the mCreatePrompt is reselected.
-	if (mIsBarrelCovered)
+	mVoicePool.play(SoundEffects::ID::Object);
+	if (isBarrelCovered())
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectCoveredBarrel"));
 	else
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectBarrel"));
-	mSelected = true;
 }
 
 void BarrelNode::updateUndoUI()
@@ -179,9 +161,15 @@ void BarrelNode::updateUndoUI()
 
 	// ALW - Tells the BarrelUINode whether to draw the UI or not.
 	if (mSelected)
-		InteractiveNode::sendEvent(mDrawBarrelUI);
+		InteractiveNode::postEvent(Events::DrawBarrelUI);
 	else
-		InteractiveNode::sendEvent(mDoNotDrawBarrelUI);
+		InteractiveNode::postEvent(Events::DoNotDrawBarrelUI);
+}
+
+void BarrelNode::spawnMosquito()
+{
+	mSpawnEvent = mScheduler.schedule(mSpawnDelay, std::bind(&BarrelNode::spawnMosquito, this));
+	mSpawnQueue.push_back(mBarrelID);
 }
 
 void BarrelNode::addCover()
@@ -189,8 +177,7 @@ void BarrelNode::addCover()
 	if (mDaylightUI.subtract(mCoverCost))
 	{
 		// ALW - There was enough daylight to "purchase" the item.
-		mIsBarrelCovered = true;
-		InteractiveNode::sendEvent(mDrawBarrelSprite);
+		mRegistry.setCovered(mEntity, true);
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseCover"));
 		mUIElemStates.front() = false;
 	}
@@ -206,8 +193,7 @@ void BarrelNode::addCover()
 
 void BarrelNode::undoCover()
 {
-	mIsBarrelCovered = false;
-	InteractiveNode::sendEvent(mDoNotDrawBarrelSprite);
+	mRegistry.setCovered(mEntity, false);
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundCover"));
 	mDaylightUI.add(mCoverCost);
 	mUIElemStates.front() = true;
@@ -3,14 +3,15 @@
 
 #include "PreventionNode.h"
 #include "../HUD/undoUI.h"
+#include "../Simulation/eventScheduler.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Events/eventStr.h"
 #include "Trambo/Resources/resourceHolder.h"
 
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <cstddef>
 #include <deque>
 #include <vector>
 
@@ -23,15 +24,13 @@ namespace sf
 	class View;
 }
 
-namespace trmb
-{
-	class SoundPlayer;
-}
-
 class ChatBoxUI;
 class DaylightUI;
 class InteractiveObject;
+class MousePicker;
+class Snapshot;
 class UIBundle;
+class VoicePool;
 
 class BarrelNode : public PreventionNode
 {
@@ -41,13 +40,22 @@ private:
 
 public:
 								BarrelNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle, int barrelID, const trmb::TextureHolder &textures
-									, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity, std::size_t barrelID
+									, std::vector<std::size_t> &spawnQueue
+									, const trmb::TextureHolder &textures, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI
+									, EventScheduler &scheduler, VoicePool &voicePool);
 								BarrelNode(const BarrelNode &) = delete;
 	BarrelNode &				operator=(const BarrelNode &) = delete;
 
+	bool						isBarrelCovered() const;
+	sf::Time					getSpawnDelay() const;
+	sf::Time					getSpawnTimer() const;
 	virtual sf::FloatRect		getBoundingRect() const override;
 
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
 	virtual void				handleEvent(const trmb::Event &gameEvent) override final;
 
 
@@ -56,31 +64,24 @@ private:
 	virtual void				updateCurrent(sf::Time dt) override final;
 	virtual void				activate() override final;
 	void						updateUndoUI();
+	void						spawnMosquito();
 
 	void						addCover();
 	void						undoCover();
 
 
 private:
-	const trmb::Event			mBarrelUIActivated;
-	const trmb::Event			mDrawBarrelUI;
-	const trmb::Event			mDoNotDrawBarrelUI;
-	const trmb::EventStr		mDrawBarrelSprite;
-	const trmb::EventStr		mDoNotDrawBarrelSprite;
-	const trmb::EventStr		mSpawnMosquitoEvent;		// ALW - Is sent from here.
-	const EventGuid				mLeftClickPress;			// ALW - Matches the GUID in the Controller class.
-	const EventGuid				mCreateTextPrompt;			// ALW - Matches the GUID in the ChatBoxUI class.
-	const EventGuid				mClearTextPrompt;			// ALW - Matches the GUID in the ChatBoxUI class.
 	const float					mCoverCost;
 	const trmb::TextureHolder	&mTextures;
-	trmb::SoundPlayer			&mSoundPlayer;
 	DaylightUI					&mDaylightUI;
 	ChatBoxUI					&mChatBoxUI;
-	bool						mBarrelUIActive;
-	bool						mIsBarrelCovered;
+	EventScheduler				&mScheduler;
+	VoicePool					&mVoicePool;
+	const std::size_t			mBarrelID;
+	std::vector<std::size_t>	&mSpawnQueue;		// ALW - The World spawns the mosquitoes for each barrel ID queued here
 
 	const sf::Time				mSpawnDelay;
-	sf::Time					mSpawnTimer;
+	EventScheduler::EventID		mSpawnEvent;
 
 	// ALW - STL containers are used here, so the interface of the UndoUI class is the same for an instance of UndoUI with 
 	// ALW - one or multiple UI elements.
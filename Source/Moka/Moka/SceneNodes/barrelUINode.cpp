@@ -1,4 +1,5 @@
 #include "barrelUINode.h"
+#include "../Application/eventIdentifiers.h"
 #include "../HUD/UndoUI.h"
 
 #include "Trambo/Events/event.h"
@@ -8,20 +9,18 @@
 
 
 BarrelUINode::BarrelUINode(const UndoUI &barrelUI)
-: mDrawUI(0xcfdb933d)
-, mDoNotDrawUI(0x210832f5)
-, mUI(barrelUI)
+: mUI(barrelUI)
 , mIsDrawn(false)
 {
 }
 
 void BarrelUINode::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mDrawUI == gameEvent.getType())
+	if (Events::DrawBarrelUI == gameEvent.getType())
 	{
 		mIsDrawn = true;
 	}
-	else if (mDoNotDrawUI == gameEvent.getType())
+	else if (Events::DoNotDrawBarrelUI == gameEvent.getType())
 	{
 		mIsDrawn = false;
 	}
@@ -3,10 +3,6 @@
 
 #include "interactiveNode.h"
 
-#include <SFML/Graphics/Rect.hpp>
-
-#include <vector>
-
 
 namespace sf
 {
@@ -15,27 +11,21 @@ namespace sf
 }
 
 class InteractiveObject;
+class MousePicker;
 class UIBundle;
 
 class BuildingNode : public InteractiveNode // inherits SceneNode and EventHandler indirectly
 {
 public:
 								BuildingNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle, std::vector<sf::FloatRect> attachedRects);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity);
 								BuildingNode(const BuildingNode &) = delete;
 	BuildingNode &				operator=(const BuildingNode &) = delete;
 
 
 private:
 	virtual void				activate() = 0;
-
-
-protected:
-	virtual bool				isMouseOverObject() const override final;
-
-
-private:
-	std::vector<sf::FloatRect>	mAttachedRects;
 };
 
 #endif
@@ -1,14 +1,17 @@
 #include "clinicNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/voicePool.h"
 #include "../GameObjects/interactiveObject.h"
 #include "../HUD/chatBoxUI.h"
 #include "../HUD/daylightUI.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/undoUI.h"
 #include "../HUD/uiBundle.h"
+#include "../Player/mousePicker.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Localize/localize.h"
-#include "Trambo/Sounds/soundPlayer.h"
 #include "Trambo/Utilities/utility.h"
 
 #include <SFML/Graphics/RenderStates.hpp>
@@ -20,29 +23,17 @@
 
 
 ClinicNode::ClinicNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window, const sf::View &view
-	, UIBundle &mUIBundle, std::vector<sf::FloatRect> attachedRects, const trmb::TextureHolder &textures, trmb::SoundPlayer &soundPlayer
-	, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI)
-: BuildingNode(interactiveObject, window, view, mUIBundle, attachedRects)
-, mClinicUIActivated(0xcb9e3f21)
-, mDrawClinicUI(0x1363b002)
-, mDoNotDrawClinicUI(0x7ccd235d)
-, mDrawSmallRDTCrateSprite(0x3377fe93, interactiveObject.getName())
-, mDrawLargeRDTCrateSprite(0x358963ee, interactiveObject.getName())
-, mDrawRDTBarrelSprite(0xafbc42ce, interactiveObject.getName())
-, mDoNotRDTDrawSprite(0xf08738aa, interactiveObject.getName())
-, mDrawSmallACTCrateSprite(0x7f31c614, interactiveObject.getName())
-, mDrawLargeACTCrateSprite(0x4a640fb6, interactiveObject.getName())
-, mDrawACTBarrelSprite(0xad344f84, interactiveObject.getName())
-, mDoNotACTDrawSprite(0xd6fe68f2, interactiveObject.getName())
-, mLeftClickPress(0x6955d309)
+	, UIBundle &uiBundle, const MousePicker &mousePicker, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+	, const trmb::TextureHolder &textures, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI
+	, VoicePool &voicePool)
+: BuildingNode(interactiveObject, window, view, uiBundle, mousePicker, registry, entity)
 , mRDTCost(2.0f)
 , mACTCost(2.0f)
 , mTextures(textures)
-, mSoundPlayer(soundPlayer)
 , mDaylightUI(daylightUI)
 , mChatBoxUI(chatBoxUI)
+, mVoicePool(voicePool)
 , mRedCross(mTextures.get(Textures::ID::RedCross))
-, mClinicUIActive(false)
 , mRDTCount(0)
 , mACTCount(0)
 {
@@ -63,6 +54,20 @@ int ClinicNode::getTotalACTs() const
 	return mACTCount;
 }
 
+void ClinicNode::save(Snapshot &snapshot) const
+{
+	snapshot.write(mRDTCount);
+	snapshot.write(mACTCount);
+}
+
+void ClinicNode::load(Snapshot &snapshot)
+{
+	snapshot.read(mRDTCount);
+	snapshot.read(mACTCount);
+	assert(("The RDT count is out of range!", MinRDTCount <= mRDTCount && mRDTCount <= MaxRDTCount));
+	assert(("The ACT count is out of range!", MinACTCount <= mACTCount && mACTCount <= MaxACTCount));
+}
+
 void ClinicNode::handleEvent(const trmb::Event &gameEvent)
 {
 	InteractiveNode::handleEvent(gameEvent);
@@ -71,57 +76,32 @@ void ClinicNode::handleEvent(const trmb::Event &gameEvent)
 	{
 		mUIBundle.getClinicUI().hide();
 	}
-	else if (!mDisableInput
-		  && !isMouseOverUI(mUIBundle.getChatBoxUI().getRect())
-		  && !isMouseOverUI(mUIBundle.getDaylightUI().getRect()))
+	else if (!mDisableInput && !mMousePicker.isMouseOverInputUI())
 	{
-		if (mClinicUIActivated.getType() == gameEvent.getType())
-		{
-			// ALW - This is a workaround to fix an issue where an object had selection and then another object of the same
-			// ALW - type (barrel, door, window, clinic, house) was selected earlier in the SceneNode. What happened was
-			// ALW - the newly selected object would enable the UI, but then the previously selected object would disable the
-			// ALW - UI. This was not an issue in the reverse order. Now when an object is selected it sends a UI activated
-			// ALW - message, so an object later in the SceneNode knows not to disable the UI.
-			mClinicUIActive = true;
-		}
-		else if (mLeftClickPress == gameEvent.getType())
+		if (Events::LeftClickPress == gameEvent.getType())
 		{
 			mPreviousSelectedState = mSelected;
-			if (mSelected && !isMouseOverUI(mUIBundle.getClinicUI().getRect()))
+			if (mSelected && !mMousePicker.isMouseOverUI(MousePicker::UI::Clinic))
 			{
 				mSelected = false;
 			}
 
-			if (isMouseOverObject()
-				&& !isMouseOverUI(mUIBundle.getBarrelUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getDoorUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getWindowUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getClinicUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getHouseUI().getRect()))
+			// ALW - The MousePicker has already resolved which object, if any, the click landed on.
+			if (mMousePicker.getPickedEntity() == mEntity)
 			{
 				mSelected = true;
 				if (!mPreviousSelectedState)
 					activate();
 			}
 
-			if (mPreviousSelectedState && !mSelected && mClinicUIActive)
+			if (mPreviousSelectedState && !mSelected)
 			{
-				// ALW - The object was unselected, because another object of the same type was selected.
-				// ALW - Therefore, the object's UI is still in use. Only reset the UI.
+				// ALW - When another clinic was picked the UI is still in use, so it is only reset. Otherwise the click
+				// ALW - did not land on a clinic and the UI is reset and hidden.
 				mUIBundle.getClinicUI().reset();
+				if (!mMousePicker.isPicked(InteractiveRegistry::Kind::Clinic))
+					mUIBundle.getClinicUI().hide();
 			}
-			else if (mPreviousSelectedState && !mSelected && !mClinicUIActive)
-			{
-				// ALW - Two scenarios are possible. First, an object earlier in the SceneNode is unselected. The UI
-				// ALW - will be reset and hidden. This behavior is ok, because if an object later in the SceneNode
-				// ALW - is then selected it will unhide itself. Next, the object may be unselected, because the click
-				// ALW - did not occur on an object of the same type. Here the UI is not in use, so resetting and hiding
-				// ALW - the UI is the desired behavior.
-				mUIBundle.getClinicUI().reset();
-				mUIBundle.getClinicUI().hide();
-			}
-
-			mClinicUIActive = false;
 		}
 	}
 }
@@ -155,21 +135,8 @@ void ClinicNode::updateCurrent(sf::Time)
 void ClinicNode::activate()
 {
 	updateOptionsUI();
-	mSoundPlayer.play(SoundEffects::ID::Object);
-	InteractiveNode::sendEvent(mClinicUIActivated);
-	// ALW - ChatBoxUI::UpdateText() can generate a mCreatePrompt event when an interactive object
-	// ALW - is selected. This asynchronous event will force InteractiveNode classes to ignore
-	// ALW - left and right click events. Then if <enter> is pressed an mEnter event will be
-	// ALW - generated allowing InteractiveNode classes to handle left and right click events.
-	// ALW - However, if another interactive object is selected that occurs before the currently
-	// ALW - selected interactive object in the SceneNode then this newly selected interactive
-	// ALW - object will cause ChatBoxUI::UpdateText() to be called which generates a mCreatePrompt.
-	// ALW - InteractiveNodes are then forced to ignore left and right click events, so the original
-	// ALW - interactive object will be left selected. To remedy this all InteractiveNodes deselect
-	// ALW - themselves when a mCreatePrompt is generated. Immediately afterwards the InteractiveNode
-	// ALW - that generated the mCreatePrompt is reselected.
+	mVoicePool.play(SoundEffects::ID::Object);
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectClinic"));
-	mSelected = true;
 }
 
 void ClinicNode::updateOptionsUI()
@@ -191,9 +158,9 @@ void ClinicNode::updateOptionsUI()
 
 	// ALW - Tells the ClinicUINode whether to draw the UI or not.
 	if (mSelected)
-		InteractiveNode::sendEvent(mDrawClinicUI);
+		InteractiveNode::postEvent(Events::DrawClinicUI);
 	else
-		InteractiveNode::sendEvent(mDoNotDrawClinicUI);
+		InteractiveNode::postEvent(Events::DoNotDrawClinicUI);
 }
 
 void ClinicNode::incrementPurchaseRDT()
@@ -201,7 +168,6 @@ void ClinicNode::incrementPurchaseRDT()
 	if (mDaylightUI.subtract(mRDTCost))
 	{
 		++mRDTCount;
-		calculateRDTEvent();
 		updateRDTDisableState();
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseRDT"));
 	}
@@ -214,7 +180,6 @@ void ClinicNode::incrementPurchaseRDT()
 void ClinicNode::decrementPurchaseRDT()
 {
 	--mRDTCount;
-	calculateRDTEvent();
 	updateRDTDisableState();
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundRDT"));
 	mDaylightUI.add(mRDTCost);
@@ -225,7 +190,6 @@ void ClinicNode::incrementPurchaseACT()
 	if (mDaylightUI.subtract(mACTCost))
 	{
 		++mACTCount;
-		calculateACTEvent();
 		updateACTDisableState();
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseACT"));
 	}
@@ -238,54 +202,11 @@ void ClinicNode::incrementPurchaseACT()
 void ClinicNode::decrementPurchaseACT()
 {
 	--mACTCount;
-	calculateACTEvent();
 	updateACTDisableState();
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundACT"));
 	mDaylightUI.add(mACTCost);
 }
 
-void ClinicNode::calculateRDTEvent()
-{
-	switch (mRDTCount)
-	{
-	case NoRDTs:
-		InteractiveNode::sendEvent(mDoNotRDTDrawSprite);
-		break;
-	case SmallRDTCrate:
-		InteractiveNode::sendEvent(mDrawSmallRDTCrateSprite);
-		break;
-	case LargeRDTCrate:
-		InteractiveNode::sendEvent(mDrawLargeRDTCrateSprite);
-		break;
-	case RDTBarrel:
-		InteractiveNode::sendEvent(mDrawRDTBarrelSprite);
-		break;
-	default:
-		assert(("The RDT count is out of range!", false));
-	}
-}
-
-void ClinicNode::calculateACTEvent()
-{
-	switch (mACTCount)
-	{
-	case NoACTs:
-		InteractiveNode::sendEvent(mDoNotACTDrawSprite);
-		break;
-	case SmallACTCrate:
-		InteractiveNode::sendEvent(mDrawSmallACTCrateSprite);
-		break;
-	case LargeACTCrate:
-		InteractiveNode::sendEvent(mDrawLargeACTCrateSprite);
-		break;
-	case ACTBarrel:
-		InteractiveNode::sendEvent(mDrawACTBarrelSprite);
-		break;
-	default:
-		assert(("The ACT count is out of range!", false));
-	}
-}
-
 void ClinicNode::updateRDTDisableState()
 {
 	assert(("The RDT count is out of range!", MinRDTCount <= mRDTCount && mRDTCount <= MaxRDTCount));
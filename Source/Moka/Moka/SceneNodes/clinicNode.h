@@ -4,7 +4,6 @@
 #include "buildingNode.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Events/eventStr.h"
 #include "Trambo/Resources/resourceHolder.h"
 
 #include <SFML/Graphics/Rect.hpp>
@@ -22,29 +21,31 @@ namespace sf
 	class View;
 }
 
-namespace trmb
-{
-	class SoundPlayer;
-}
-
 class ChatBoxUI;
 class DaylightUI;
 class InteractiveObject;
+class MousePicker;
+class Snapshot;
 class UIBundle;
+class VoicePool;
 
 class ClinicNode : public BuildingNode // inherits SceneNode, EventHandler, and InteractiveNode indirectly
 {
 public:
 								ClinicNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &mUIBundle, std::vector<sf::FloatRect> attachedRects
-									, const trmb::TextureHolder &textures, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI
-									, ChatBoxUI &chatBoxUI);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+									, const trmb::TextureHolder &textures, DaylightUI &daylightUI
+									, ChatBoxUI &chatBoxUI, VoicePool &voicePool);
 								ClinicNode(const ClinicNode &) = delete;
 	ClinicNode &				operator=(const ClinicNode &) = delete;
 
 	int							getTotalRDTs() const;
 	int							getTotalACTs() const;
 
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
 	virtual void				handleEvent(const trmb::Event &gameEvent) override final;
 
 
@@ -81,33 +82,18 @@ private:
 	void						incrementPurchaseACT();
 	void						decrementPurchaseACT();
 
-	void						calculateRDTEvent();
-	void						calculateACTEvent();
 	void						updateRDTDisableState();
 	void						updateACTDisableState();
 
 
 private:
-	const trmb::Event			mClinicUIActivated;
-	const trmb::Event			mDrawClinicUI;
-	const trmb::Event			mDoNotDrawClinicUI;
-	const trmb::EventStr		mDrawSmallRDTCrateSprite;
-	const trmb::EventStr		mDrawLargeRDTCrateSprite;
-	const trmb::EventStr		mDrawRDTBarrelSprite;
-	const trmb::EventStr		mDoNotRDTDrawSprite;
-	const trmb::EventStr		mDrawSmallACTCrateSprite;
-	const trmb::EventStr		mDrawLargeACTCrateSprite;
-	const trmb::EventStr		mDrawACTBarrelSprite;
-	const trmb::EventStr		mDoNotACTDrawSprite;
-	const EventGuid				mLeftClickPress;   // ALW - Matches the GUID in the Controller class.
 	const float					mRDTCost;
 	const float					mACTCost;
 	const trmb::TextureHolder	&mTextures;
-	trmb::SoundPlayer			&mSoundPlayer;
 	DaylightUI					&mDaylightUI;
 	ChatBoxUI					&mChatBoxUI;
+	VoicePool					&mVoicePool;
 	sf::Sprite					mRedCross;
-	bool						mClinicUIActive;
 	int							mRDTCount;
 	int							mACTCount;
 };
@@ -1,4 +1,5 @@
 #include "clinicUINode.h"
+#include "../Application/eventIdentifiers.h"
 #include "../HUD/OptionsUI.h"
 
 #include "Trambo/Events/event.h"
@@ -8,20 +9,18 @@
 
 
 ClinicUINode::ClinicUINode(const OptionsUI &clinicUI)
-: mDrawUI(0x1363b002)
-, mDoNotDrawUI(0x7ccd235d)
-, mUI(clinicUI)
+: mUI(clinicUI)
 , mIsDrawn(false)
 {
 }
 
 void ClinicUINode::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mDrawUI == gameEvent.getType())
+	if (Events::DrawClinicUI == gameEvent.getType())
 	{
 		mIsDrawn = true;
 	}
-	else if (mDoNotDrawUI == gameEvent.getType())
+	else if (Events::DoNotDrawClinicUI == gameEvent.getType())
 	{
 		mIsDrawn = false;
 	}
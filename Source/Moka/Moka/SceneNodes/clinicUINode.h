@@ -30,17 +30,11 @@ public:
 	virtual void		handleEvent(const trmb::Event &gameEvent) override final;
 
 
-private:
-	typedef unsigned long EventGuid;
-
-
 private:
 	virtual void		drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override;
 
 
 private:
-	const EventGuid     mDrawUI;	  // ALW - Matches the GUID in the ClinicNode class.
-	const EventGuid     mDoNotDrawUI; // ALW - Matches the GUID in the ClinicNode class.
 	const OptionsUI		&mUI;
 	bool				mIsDrawn;
 };
@@ -0,0 +1,156 @@
+#include "culledLayerNode.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+
+const std::size_t CulledLayerNode::noChild = std::numeric_limits<std::size_t>::max();
+
+CulledLayerNode::CulledLayerNode(sf::FloatRect worldBounds)
+: mWorldBounds(worldBounds)
+, mCellSize(256.0f)
+, mCellsWide(std::max(1, static_cast<int>(std::ceil(worldBounds.width / mCellSize))))
+, mCellsHigh(std::max(1, static_cast<int>(std::ceil(worldBounds.height / mCellSize))))
+, mNodes()
+, mChildren()
+, mCells()
+, mMaxSize()
+{
+	const Cell empty = { noChild, noChild };
+	mCells.assign(mCellsWide * mCellsHigh, empty);
+}
+
+void CulledLayerNode::attachCulledChild(trmb::SceneNode::Ptr child, sf::FloatRect bounds)
+{
+	attach(std::move(child), bounds, false);
+}
+
+void CulledLayerNode::attachMovingChild(trmb::SceneNode::Ptr child)
+{
+	const sf::FloatRect bounds = child->getBoundingRect();
+	attach(std::move(child), bounds, true);
+}
+
+void CulledLayerNode::updateCurrent(sf::Time dt)
+{
+	for (std::size_t childID = 0; childID < mChildren.size(); ++childID)
+	{
+		Child &child = mChildren[childID];
+		mNodes[childID]->update(dt);
+
+		if (!child.moving)
+			continue;
+
+		child.bounds = mNodes[childID]->getBoundingRect();
+		mMaxSize.x = std::max(mMaxSize.x, child.bounds.width);
+		mMaxSize.y = std::max(mMaxSize.y, child.bounds.height);
+
+		if (getCell(child.bounds) != child.cell)
+		{
+			removeFromCell(childID);
+			addToCell(childID);
+		}
+	}
+}
+
+void CulledLayerNode::drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const
+{
+	// ALW - Pad the view, so anything a child draws just past its bounds, like a HouseTrackerUI, is not
+	// ALW - cut off at the edge of the screen.
+	const float margin = 128.0f;
+
+	const sf::View &view = target.getView();
+	const sf::FloatRect visible(view.getCenter().x - view.getSize().x / 2.0f - margin
+		, view.getCenter().y - view.getSize().y / 2.0f - margin, view.getSize().x + margin * 2.0f
+		, view.getSize().y + margin * 2.0f);
+
+	// ALW - A child is bucketed by its top-left corner, so look as far back as the largest child.
+	const int firstColumn = std::max(0, static_cast<int>(std::floor((visible.left - mMaxSize.x - mWorldBounds.left) / mCellSize)));
+	const int lastColumn = std::min(mCellsWide - 1, static_cast<int>(std::floor((visible.left + visible.width - mWorldBounds.left) / mCellSize)));
+	const int firstRow = std::max(0, static_cast<int>(std::floor((visible.top - mMaxSize.y - mWorldBounds.top) / mCellSize)));
+	const int lastRow = std::min(mCellsHigh - 1, static_cast<int>(std::floor((visible.top + visible.height - mWorldBounds.top) / mCellSize)));
+
+	for (int row = firstRow; row <= lastRow; ++row)
+	{
+		for (int column = firstColumn; column <= lastColumn; ++column)
+		{
+			for (std::size_t childID = mCells[row * mCellsWide + column].head; noChild != childID; childID = mChildren[childID].next)
+			{
+				if (mChildren[childID].bounds.intersects(visible))
+					target.draw(*mNodes[childID], states);
+			}
+		}
+	}
+}
+
+void CulledLayerNode::attach(trmb::SceneNode::Ptr child, sf::FloatRect bounds, bool moving)
+{
+	mMaxSize.x = std::max(mMaxSize.x, bounds.width);
+	mMaxSize.y = std::max(mMaxSize.y, bounds.height);
+
+	const Child entry = { bounds, -1, noChild, noChild, moving };
+	mNodes.push_back(std::move(child));
+	mChildren.push_back(entry);
+	addToCell(mChildren.size() - 1);
+}
+
+void CulledLayerNode::addToCell(std::size_t childID)
+{
+	Child &child = mChildren[childID];
+	child.cell = getCell(child.bounds);
+	if (-1 == child.cell)
+		return;
+
+	// ALW - Append, so the children of a cell are drawn in the order they were attached.
+	Cell &cell = mCells[child.cell];
+	child.previous = cell.tail;
+	child.next = noChild;
+
+	if (noChild == cell.tail)
+		cell.head = childID;
+	else
+		mChildren[cell.tail].next = childID;
+
+	cell.tail = childID;
+}
+
+void CulledLayerNode::removeFromCell(std::size_t childID)
+{
+	Child &child = mChildren[childID];
+	if (-1 == child.cell)
+		return;
+
+	Cell &cell = mCells[child.cell];
+	assert(("The child is missing from its cell!", noChild != child.previous || cell.head == childID));
+
+	if (noChild == child.previous)
+		cell.head = child.next;
+	else
+		mChildren[child.previous].next = child.next;
+
+	if (noChild == child.next)
+		cell.tail = child.previous;
+	else
+		mChildren[child.next].previous = child.previous;
+
+	child.cell = -1;
+	child.previous = noChild;
+	child.next = noChild;
+}
+
+int CulledLayerNode::getCell(sf::FloatRect bounds) const
+{
+	if (bounds.width <= 0.0f || bounds.height <= 0.0f)
+		return -1;
+
+	const int column = static_cast<int>(std::floor((bounds.left - mWorldBounds.left) / mCellSize));
+	const int row = static_cast<int>(std::floor((bounds.top - mWorldBounds.top) / mCellSize));
+
+	return std::min(mCellsHigh - 1, std::max(0, row)) * mCellsWide + std::min(mCellsWide - 1, std::max(0, column));
+}
@@ -0,0 +1,79 @@
+#ifndef CULLED_LAYER_NODE_H
+#define CULLED_LAYER_NODE_H
+
+#include "Trambo/SceneNodes/sceneNode.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+	class RenderStates;
+	class RenderTarget;
+}
+
+// ALW - A layer that only draws the children overlapping the view. The children are bucketed into a grid of
+// ALW - cells by the top-left corner of their bounds, so a draw only visits the cells under the view and the
+// ALW - children in them. A moving child is bucketed again when its bounding rect crosses into another cell.
+// ALW - Each cell is a linked list threaded through the children, so moving a child never allocates.
+// ALW - The children are owned here instead of being attached with trmb::SceneNode::attachChild(), but they
+// ALW - are still updated every frame.
+class CulledLayerNode : public trmb::SceneNode
+{
+public:
+	explicit					CulledLayerNode(sf::FloatRect worldBounds);
+								CulledLayerNode(const CulledLayerNode &) = delete;
+	CulledLayerNode &			operator=(const CulledLayerNode &) = delete;
+
+	void						attachCulledChild(trmb::SceneNode::Ptr child, sf::FloatRect bounds);
+	void						attachMovingChild(trmb::SceneNode::Ptr child);	// ALW - Uses the child's getBoundingRect()
+
+
+private:
+	struct Child
+	{
+		sf::FloatRect			bounds;
+		int						cell;		// ALW - -1 when the bounds are empty, which is never drawn
+		std::size_t				previous;
+		std::size_t				next;
+		bool					moving;
+	};
+
+	struct Cell
+	{
+		std::size_t				head;
+		std::size_t				tail;
+	};
+
+
+private:
+	static const std::size_t	noChild;
+
+
+private:
+	virtual void				updateCurrent(sf::Time dt) override;
+	virtual void				drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override;
+
+	void						attach(trmb::SceneNode::Ptr child, sf::FloatRect bounds, bool moving);
+	void						addToCell(std::size_t childID);
+	void						removeFromCell(std::size_t childID);
+	int							getCell(sf::FloatRect bounds) const;
+
+
+private:
+	const sf::FloatRect						mWorldBounds;
+	const float								mCellSize;
+	const int								mCellsWide;
+	const int								mCellsHigh;
+	std::vector<trmb::SceneNode::Ptr>		mNodes;
+	std::vector<Child>						mChildren;		// ALW - Indexed in the same order as mNodes
+	std::vector<Cell>						mCells;
+	sf::Vector2f							mMaxSize;		// ALW - Largest child, so a child reaching into the view from an earlier cell is found
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "darkness.h"
+#include "../Application/eventIdentifiers.h"
 
 #include "Trambo/Events/event.h"
 
@@ -7,52 +8,34 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <functional>
 
-Darkness::Darkness(const sf::RenderWindow &window)
-: mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
-, mBeginSimulationEvent(0x5000e550)
-, mWindow(window)
+
+Darkness::Darkness(const sf::RenderWindow &window, EventScheduler &scheduler)
+: mWindow(window)
+, mScheduler(scheduler)
 , mBackground()
 , mDarken(false)
 , mAlpha(0u)
 , mCount(0)
-, mUpdateTime()
+, mFadeTime(sf::seconds(0.1f))
 {
 	mBackground.setSize(sf::Vector2f(mWindow.getSize()));
 	mBackground.setFillColor(sf::Color(0u, 0u, 0u, 0u));
 	mBackground.setPosition(0.0f, 0.0f);
 }
 
-void Darkness::updateCurrent(sf::Time dt)
-{
-	// ALW - Simulation Mode
-	const int iterations = 30;
-	if (mDarken && mCount < iterations)
-	{
-		mUpdateTime += dt;
-
-		if (mUpdateTime >= sf::seconds(0.1f))
-		{
-			mAlpha += 3u; // ALW - Will max at 90u
-			mBackground.setFillColor(sf::Color(0u, 0u, 0u, mAlpha));
-			++mCount;
-
-			mUpdateTime -= sf::seconds(0.1f);
-		}
-	}
-}
-
 void Darkness::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		reposition();
 	}
-	else if (mBeginSimulationEvent == gameEvent.getType())
+	else if (Events::BeginSimulation == gameEvent.getType())
 	{
 		mDarken = true;
+		mScheduler.schedule(mFadeTime, std::bind(&Darkness::darken, this));
 	}
 }
 
@@ -69,6 +52,18 @@ void Darkness::drawCurrent(sf::RenderTarget &target, sf::RenderStates states) co
 	target.setView(previousView);
 }
 
+void Darkness::darken()
+{
+	// ALW - Simulation Mode
+	const int iterations = 30;
+	mAlpha += 3u; // ALW - Will max at 90u
+	mBackground.setFillColor(sf::Color(0u, 0u, 0u, mAlpha));
+	++mCount;
+
+	if (mCount < iterations)
+		mScheduler.schedule(mFadeTime, std::bind(&Darkness::darken, this));
+}
+
 void Darkness::reposition()
 {
 	// ALW - Calculate x, y coordinates relative to the center of the window,
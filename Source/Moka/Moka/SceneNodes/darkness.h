@@ -1,6 +1,8 @@
 #ifndef DARKNESS_H
 #define DARKNESS_H
 
+#include "../Simulation/eventScheduler.h"
+
 #include "Trambo/Events/eventHandler.h"
 #include "Trambo/SceneNodes/sceneNode.h"
 
@@ -23,33 +25,27 @@ namespace trambo
 class Darkness : public trmb::SceneNode, trmb::EventHandler
 {
 public:
-							Darkness(const sf::RenderWindow &window);
+							Darkness(const sf::RenderWindow &window, EventScheduler &scheduler);
 							Darkness(const Darkness &) = delete;
 	Darkness &				operator=(const Darkness &) = delete;
 
-	virtual void			updateCurrent(sf::Time dt) override final;
 	virtual void			handleEvent(const trmb::Event &gameEvent) override final;
 
 
-private:
-	using					EventGuid = unsigned long;
-
-
 private:
 	virtual void			drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override;
 	void				    reposition();
+	void					darken();
 
 
 private:
-	const EventGuid		    mFullscreen;		    // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid		    mWindowed;		        // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid         mBeginSimulationEvent;  // ALW - Matches the GUID in the DaylightUI class.
 	const sf::RenderWindow  &mWindow;
+	EventScheduler			&mScheduler;
 	sf::RectangleShape		mBackground;
 	bool					mDarken;
 	int						mCount;
 	unsigned char           mAlpha;
-	sf::Time				mUpdateTime;
+	const sf::Time			mFadeTime;			// ALW - Between each step of the fade
 };
 
 #endif
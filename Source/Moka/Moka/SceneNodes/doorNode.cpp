@@ -1,14 +1,15 @@
 #include "doorNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/voicePool.h"
 #include "../GameObjects/interactiveObject.h"
 #include "../HUD/chatBoxUI.h"
 #include "../HUD/daylightUI.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/uiBundle.h"
+#include "../Player/mousePicker.h"
 #include "../Resources/resourceIdentifiers.h"
 
 #include "Trambo/Localize/localize.h"
-#include "Trambo/Sounds/soundPlayer.h"
-#include "Trambo/Utilities/utility.h"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -18,22 +19,14 @@
 
 
 DoorNode::DoorNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window, const sf::View &view
-	, UIBundle &uiBundle, const trmb::TextureHolder &textures, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI
-	, ChatBoxUI &chatBoxUI)
-: PreventionNode(interactiveObject, window, view, uiBundle)
-, mDoorUIActivated(0xa704ae55)
-, mDrawDoorUI(0x7cf851c6)
-, mDoNotDrawDoorUI(0xc0a53a4d)
-, mDrawDoorSprite(0x5ea6cda9, interactiveObject.getName())
-, mDoNotDrawDoorSprite(0x918c6b78, interactiveObject.getName())
-, mLeftClickPress(0x6955d309)
+	, UIBundle &uiBundle, const MousePicker &mousePicker, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+	, const trmb::TextureHolder &textures, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI, VoicePool &voicePool)
+: PreventionNode(interactiveObject, window, view, uiBundle, mousePicker, registry, entity)
 , mCloseCost(0.5f)
 , mTextures(textures)
-, mSoundPlayer(soundPlayer)
 , mDaylightUI(daylightUI)
 , mChatBoxUI(chatBoxUI)
-, mDoorUIActive(false)
-, mIsDoorClosed(false)
+, mVoicePool(voicePool)
 {
 	mCallbackPairs.emplace_back(CallbackPair(std::bind(&DoorNode::closeDoor, this), std::bind(&DoorNode::openDoor, this)));
 	mUIElemStates.emplace_back(true);
@@ -41,7 +34,7 @@ DoorNode::DoorNode(const InteractiveObject &interactiveObject, const sf::RenderW
 
 bool DoorNode::isDoorClosed() const
 {
-	return mIsDoorClosed;
+	return mRegistry.getPrevention(mEntity).closed;
 }
 
 sf::FloatRect DoorNode::getBoundingRect() const
@@ -50,24 +43,6 @@ sf::FloatRect DoorNode::getBoundingRect() const
 		, mInteractiveObject.getCollisionBoxWidth(), mInteractiveObject.getCollisionBoxHeight());
 }
 
-bool DoorNode::passThrough() const
-{
-	const int enter = 0;
-	bool passThrough = false;
-
-	if (mIsDoorClosed)
-	{
-		const int diceRoll = trmb::randomInt(3); // ALW - 1/3 chance to pass through a closed door
-
-		if (diceRoll == enter)
-			passThrough = true;
-	}
-	else
-		passThrough = true; // ALW - 100% chance to pass through a open door
-
-	return passThrough;
-}
-
 void DoorNode::handleEvent(const trmb::Event &gameEvent)
 {
 	InteractiveNode::handleEvent(gameEvent);
@@ -76,50 +51,29 @@ void DoorNode::handleEvent(const trmb::Event &gameEvent)
 	{
 		mUIBundle.getDoorUI().hide();
 	}
-	else if (!mDisableInput
-		  && !isMouseOverUI(mUIBundle.getChatBoxUI().getRect())
-		  && !isMouseOverUI(mUIBundle.getDaylightUI().getRect()))
+	else if (!mDisableInput && !mMousePicker.isMouseOverInputUI())
 	{
-		if (mDoorUIActivated.getType() == gameEvent.getType())
-		{
-			// ALW - This is a workaround to fix an issue where an object had selection and then another object of the same
-			// ALW - type (barrel, door, window, clinic, house) was selected earlier in the SceneNode. What happened was
-			// ALW - the newly selected object would enable the UI, but then the previously selected object would disable the
-			// ALW - UI. This was not an issue in the reverse order. Now when an object is selected it sends a UI activated
-			// ALW - message, so an object later in the SceneNode knows not to disable the UI.
-			mDoorUIActive = true;
-		}
-		else if (mLeftClickPress == gameEvent.getType())
+		if (Events::LeftClickPress == gameEvent.getType())
 		{
 			mPreviousSelectedState = mSelected;
-			if (mSelected && !isMouseOverUI(mUIBundle.getDoorUI().getRect()))
+			if (mSelected && !mMousePicker.isMouseOverUI(MousePicker::UI::Door))
 			{
 				mSelected = false;
 			}
 
-			if (isMouseOverObject()
-				&& !isMouseOverUI(mUIBundle.getBarrelUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getDoorUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getWindowUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getClinicUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getHouseUI().getRect()))
+			// ALW - The MousePicker has already resolved which object, if any, the click landed on.
+			if (mMousePicker.getPickedEntity() == mEntity)
 			{
 				mSelected = true;
 				if (!mPreviousSelectedState)
 					activate();
 			}
 
-			if (mPreviousSelectedState && !mSelected && !mDoorUIActive)
+			if (mPreviousSelectedState && !mSelected && !mMousePicker.isPicked(InteractiveRegistry::Kind::Door))
 			{
-				// ALW - Two scenarios are possible. First, an object earlier in the SceneNode is unselected. The UI
-				// ALW - will be hidden. This behavior is ok, because if an object later in the SceneNode
-				// ALW - is then selected it will unhide itself. Next, the object may be unselected, because the click
-				// ALW - did not occur on an object of the same type. Here the UI is not in use, so resetting and hiding
-				// ALW - the UI is the desired behavior.
+				// ALW - The click did not land on another door, so the UI is no longer in use.
 				mUIBundle.getDoorUI().hide();
 			}
-
-			mDoorUIActive = false;
 		}
 	}
 }
@@ -151,24 +105,11 @@ void DoorNode::updateCurrent(sf::Time)
 void DoorNode::activate()
 {
 	updateUndoUI();	
-	mSoundPlayer.play(SoundEffects::ID::Object);
-	InteractiveNode::sendEvent(mDoorUIActivated);
-	// ALW - ChatBoxUI::UpdateText() can generate a mCreatePrompt event when an interactive object
-	// ALW - is selected. This asynchronous event will force InteractiveNode classes to ignore
-	// ALW - left and right click events. Then if <enter> is pressed an mEnter event will be
-	// ALW - generated allowing InteractiveNode classes to handle left and right click events.
-	// ALW - However, if another interactive object is selected that occurs before the currently
-	// ALW - selected interactive object in the SceneNode then this newly selected interactive
-	// ALW - object will cause ChatBoxUI::UpdateText() to be called which generates a mCreatePrompt.
-	// ALW - InteractiveNodes are then forced to ignore left and right click events, so the original
-	// ALW - interactive object will be left selected. To remedy this all InteractiveNodes deselect
-	// ALW - themselves when a mCreatePrompt is generated. Immediately afterwards the InteractiveNode
-	// ALW - that generated the mCreatePrompt is reselected.
-	if (mIsDoorClosed)
+	mVoicePool.play(SoundEffects::ID::Object);
+	if (isDoorClosed())
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectClosedDoor"));
 	else
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectDoor"));
-	mSelected = true;
 }
 
 void DoorNode::updateUndoUI()
@@ -178,9 +119,9 @@ void DoorNode::updateUndoUI()
 
 	// ALW - Tells the DoorUINode whether to draw the UI or not.
 	if (mSelected)
-		InteractiveNode::sendEvent(mDrawDoorUI);
+		InteractiveNode::postEvent(Events::DrawDoorUI);
 	else
-		InteractiveNode::sendEvent(mDoNotDrawDoorUI);
+		InteractiveNode::postEvent(Events::DoNotDrawDoorUI);
 
 	const float verticalBuffer = 10.0f;
 	mUIBundle.getDoorUI().setPosition(sf::Vector2f(mInteractiveObject.getX() + mInteractiveObject.getWidth() / 2.0f
@@ -195,8 +136,7 @@ void DoorNode::closeDoor()
 {
 	if (mDaylightUI.subtract(mCloseCost))
 	{
-		mIsDoorClosed = true;
-		InteractiveNode::sendEvent(mDrawDoorSprite);
+		mRegistry.setClosed(mEntity, true);
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseClosedDoor"));
 		mUIElemStates.front() = false;
 	}
@@ -212,8 +152,7 @@ void DoorNode::closeDoor()
 
 void DoorNode::openDoor()
 {
-	mIsDoorClosed = false;
-	InteractiveNode::sendEvent(mDoNotDrawDoorSprite);
+	mRegistry.setClosed(mEntity, false);
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundClosedDoor"));
 	mDaylightUI.add(mCloseCost);
 	mUIElemStates.front() = true;
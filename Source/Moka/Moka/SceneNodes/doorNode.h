@@ -5,7 +5,6 @@
 #include "../HUD/undoUI.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Events/eventStr.h"
 #include "Trambo/Resources/resourceHolder.h"
 
 #include <SFML/Graphics/Sprite.hpp>
@@ -23,15 +22,12 @@ namespace sf
 	class View;
 }
 
-namespace trmb
-{
-	class SoundPlayer;
-}
-
 class ChatBoxUI;
 class DaylightUI;
 class InteractiveObject;
+class MousePicker;
 class UIBundle;
+class VoicePool;
 
 class DoorNode : public PreventionNode
 {
@@ -41,8 +37,10 @@ private:
 
 public:
 								DoorNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle, const trmb::TextureHolder &textures
-									, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+									, const trmb::TextureHolder &textures, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI
+									, VoicePool &voicePool);
 								DoorNode(const DoorNode &) = delete;
 	DoorNode &					operator=(const DoorNode &) = delete;
 
@@ -50,8 +48,6 @@ public:
 
 	virtual sf::FloatRect		getBoundingRect() const override;
 
-	bool						passThrough() const;
-
 	virtual void				handleEvent(const trmb::Event &gameEvent) override final;
 
 
@@ -66,19 +62,11 @@ private:
 
 
 private:
-	const trmb::Event			mDoorUIActivated;
-	const trmb::Event			mDrawDoorUI;
-	const trmb::Event			mDoNotDrawDoorUI;
-	const trmb::EventStr		mDrawDoorSprite;
-	const trmb::EventStr		mDoNotDrawDoorSprite;
-	const EventGuid				mLeftClickPress;   // ALW - Matches the GUID in the Controller class.
 	const float					mCloseCost;
 	const trmb::TextureHolder	&mTextures;
-	trmb::SoundPlayer			&mSoundPlayer;
 	DaylightUI					&mDaylightUI;
 	ChatBoxUI					&mChatBoxUI;
-	bool						mDoorUIActive;
-	bool						mIsDoorClosed;
+	VoicePool					&mVoicePool;
 
 	// ALW - STL containers are used here, so the interface of the UndoUI class is the same for an instance of UndoUI with 
 	// ALW - one or multiple UI elements.
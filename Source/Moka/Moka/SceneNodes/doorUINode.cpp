@@ -1,4 +1,5 @@
 #include "doorUINode.h"
+#include "../Application/eventIdentifiers.h"
 #include "../HUD/UndoUI.h"
 
 #include "Trambo/Events/event.h"
@@ -8,20 +9,18 @@
 
 
 DoorUINode::DoorUINode(const UndoUI &doorUI)
-: mDrawUI(0x7cf851c6)
-, mDoNotDrawUI(0xc0a53a4d)
-, mUI(doorUI)
+: mUI(doorUI)
 , mIsDrawn(false)
 {
 }
 
 void DoorUINode::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mDrawUI == gameEvent.getType())
+	if (Events::DrawDoorUI == gameEvent.getType())
 	{
 		mIsDrawn = true;
 	}
-	else if (mDoNotDrawUI == gameEvent.getType())
+	else if (Events::DoNotDrawDoorUI == gameEvent.getType())
 	{
 		mIsDrawn = false;
 	}
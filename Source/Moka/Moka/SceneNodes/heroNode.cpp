@@ -1,4 +1,5 @@
 #include "heroNode.h"
+#include "../Application/eventIdentifiers.h"
 
 #include "Trambo/Events/event.h"
 
@@ -26,26 +27,18 @@ HeroNode::HeroNode(sf::FloatRect worldBounds, const sf::View &view)
 
 void HeroNode::handleEvent(const trmb::Event &gameEvent)
 {
-	// ALW - These GUIDs match the GUIDs in the Controller class.
-	const EventGuid up    = 0x84b05719;
-	const EventGuid down  = 0xa95ea771;
-	const EventGuid left  = 0x84e6c13c;
-	const EventGuid right = 0x19e343e8;
-	const EventGuid jump  = 0x6955d309;
-	const EventGuid shoot = 0x3e6524cd;
-
 	switch (gameEvent.getType())
 	{
-	case up:
+	case Events::Up:
 		accelerate(0.0f, -1.0f);
 		break;
-	case down:
+	case Events::Down:
 		accelerate(0.0f, 1.0f);
 		break;
-	case left:
+	case Events::Left:
 		accelerate(-1.0f, 0.0f);
 		break;
-	case right:
+	case Events::Right:
 		accelerate(1.0f, 0.0f);
 		break;
 	}
@@ -1,11 +1,15 @@
 #include "houseNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/voicePool.h"
 #include "../GameObjects/interactiveObject.h"
 #include "../HUD/chatBoxUI.h"
 #include "../HUD/daylightUI.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/undoUI.h"
 #include "../HUD/uiBundle.h"
+#include "../Player/mousePicker.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/snapshot.h"
 
 #include "Trambo/Localize/localize.h"
 #include "Trambo/Sounds/soundPlayer.h"
@@ -19,31 +23,15 @@
 
 
 HouseNode::HouseNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window, const sf::View &view, UIBundle &uiBundle
-	, std::vector<sf::FloatRect> attachedRects, trmb::FontHolder &fonts, trmb::SoundPlayer &soundPlayer)
-: BuildingNode(interactiveObject, window, view, uiBundle, attachedRects)
-, mHouseUIActivated(0xb5ba9eaf)
-, mAddNet1(0x43702f1a, interactiveObject.getName())
-, mAddNet2(0xc84d3fea, interactiveObject.getName())
-, mAddNet3(0x68edab82, interactiveObject.getName())
-, mRemoveNet1(0xe1636e98, interactiveObject.getName())
-, mRemoveNet2(0xadd9292e, interactiveObject.getName())
-, mRemoveNet3(0x15f4a6d9, interactiveObject.getName())
-, mRepairNet1(0xbd7bb606, interactiveObject.getName())
-, mRepairNet2(0x1b5cf244, interactiveObject.getName())
-, mRepairNet3(0x2bf40c2c, interactiveObject.getName())
-, mUnrepairNet1(0x529e6299, interactiveObject.getName())
-, mUnrepairNet2(0xfeb3945, interactiveObject.getName())
-, mUnrepairNet3(0x2aac4ae8, interactiveObject.getName())
-, mDrawHouseUI(0xc7353048)
-, mDoNotDrawHouseUI(0x8e6093bf)
-, mLeftClickPress(0x6955d309)
+	, const MousePicker &mousePicker, InteractiveRegistry &registry, InteractiveRegistry::Entity entity, trmb::FontHolder &fonts
+	, trmb::SoundPlayer &soundPlayer, VoicePool &voicePool)
+: BuildingNode(interactiveObject, window, view, uiBundle, mousePicker, registry, entity)
 , mNetCost(1.0f)
 , mRepairCost(0.5f)
-, mSoundPlayer(soundPlayer)
 , mHouseTrackerUI(Fonts::ID::Main, fonts, SoundEffects::ID::Button, soundPlayer)
 , mDaylightUI(uiBundle.getDaylightUI())
 , mChatBoxUI(uiBundle.getChatBoxUI())
-, mHouseUIActive(false)
+, mVoicePool(voicePool)
 , mTotalBeds(interactiveObject.getBeds())
 , mTotalOldNets(interactiveObject.getNets())
 , mNewNetCount(0)
@@ -82,24 +70,35 @@ sf::FloatRect HouseNode::getBoundingRect() const
 		, mInteractiveObject.getCollisionBoxWidth(), mInteractiveObject.getCollisionBoxHeight());
 }
 
-void HouseNode::addInfectedMosquito()
+void HouseNode::setInfectedMosquitoCount(int count)
 {
-	mHouseTrackerUI.addInfectedMosquito();
+	mHouseTrackerUI.setInfectedMosquitoCount(count);
 }
 
-void HouseNode::subtractInfectedMosquito()
+void HouseNode::setMosquitoTotal(int total)
 {
-	mHouseTrackerUI.subtractInfectedMosquito();
+	mHouseTrackerUI.setMosquitoTotal(total);
 }
 
-void HouseNode::addMosquitoTotal()
+void HouseNode::save(Snapshot &snapshot) const
 {
-	mHouseTrackerUI.addMosquitoTotal();
+	snapshot.write(mNewNetCount);
+	snapshot.write(mRepairCount);
 }
 
-void HouseNode::subtractMosquitoTotal()
+void HouseNode::load(Snapshot &snapshot)
 {
-	mHouseTrackerUI.subtractMosquitoTotal();
+	int newNetCount = 0;
+	int repairCount = 0;
+	snapshot.read(newNetCount);
+	snapshot.read(repairCount);
+	assert(("The net count is out of range!", 0 <= newNetCount && mTotalOldNets + newNetCount <= mTotalBeds));
+	assert(("The repair count is out of range!", 0 <= repairCount && repairCount <= mTotalOldNets));
+
+	// ALW - The InteriorBatch redraws the nets once the registry changes.
+	mNewNetCount = newNetCount;
+	mRepairCount = repairCount;
+	mRegistry.setBednets(mEntity, getTotalMintNets(), getTotalDamagedNets());
 }
 
 void HouseNode::handleEvent(const trmb::Event &gameEvent)
@@ -110,57 +109,32 @@ void HouseNode::handleEvent(const trmb::Event &gameEvent)
 	{
 		mUIBundle.getHouseUI().hide();
 	}
-	else if (!mDisableInput
-		  && !isMouseOverUI(mUIBundle.getChatBoxUI().getRect())
-		  && !isMouseOverUI(mUIBundle.getDaylightUI().getRect()))
+	else if (!mDisableInput && !mMousePicker.isMouseOverInputUI())
 	{
-		if (mHouseUIActivated.getType() == gameEvent.getType())
-		{
-			// ALW - This is a workaround to fix an issue where an object had selection and then another object of the same
-			// ALW - type (barrel, door, window, clinic, house) was selected earlier in the SceneNode. What happened was
-			// ALW - the newly selected object would enable the UI, but then the previously selected object would disable the
-			// ALW - UI. This was not an issue in the reverse order. Now when an object is selected it sends a UI activated
-			// ALW - message, so an object later in the SceneNode knows not to disable the UI.
-			mHouseUIActive = true;
-		}
-		else if (mLeftClickPress == gameEvent.getType())
+		if (Events::LeftClickPress == gameEvent.getType())
 		{
 			mPreviousSelectedState = mSelected;
-			if (mSelected && !isMouseOverUI(mUIBundle.getHouseUI().getRect()))
+			if (mSelected && !mMousePicker.isMouseOverUI(MousePicker::UI::House))
 			{
 				mSelected = false;
 			}
 
-			if (isMouseOverObject()
-				&& !isMouseOverUI(mUIBundle.getBarrelUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getDoorUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getWindowUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getClinicUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getHouseUI().getRect()))
+			// ALW - The MousePicker has already resolved which object, if any, the click landed on.
+			if (mMousePicker.getPickedEntity() == mEntity)
 			{
 				mSelected = true;
 				if (!mPreviousSelectedState)
 					activate();
 			}
 
-			if (mPreviousSelectedState && !mSelected && mHouseUIActive)
-			{
-				// ALW - The object was unselected, because another object of the same type was selected.
-				// ALW - Therefore, the object's UI is still in use. Only reset the UI.
-				mUIBundle.getHouseUI().reset();
-			}
-			else if (mPreviousSelectedState && !mSelected && !mHouseUIActive)
+			if (mPreviousSelectedState && !mSelected)
 			{
-				// ALW - Two scenarios are possible. First, an object earlier in the SceneNode is unselected. The UI
-				// ALW - will be reset and hidden. This behavior is ok, because if an object later in the SceneNode
-				// ALW - is then selected it will unhide itself. Next, the object may be unselected, because the click
-				// ALW - did not occur on an object of the same type. Here the UI is not in use, so resetting and hiding
-				// ALW - the UI is the desired behavior.
+				// ALW - When another house was picked the UI is still in use, so it is only reset. Otherwise the click
+				// ALW - did not land on a house and the UI is reset and hidden.
 				mUIBundle.getHouseUI().reset();
-				mUIBundle.getHouseUI().hide();
+				if (!mMousePicker.isPicked(InteractiveRegistry::Kind::House))
+					mUIBundle.getHouseUI().hide();
 			}
-
-			mHouseUIActive = false;
 		}
 	}
 }
@@ -194,21 +168,8 @@ void HouseNode::updateCurrent(sf::Time)
 void HouseNode::activate()
 {
 	updateOptionsUI();
-	mSoundPlayer.play(SoundEffects::ID::Object);
-	InteractiveNode::sendEvent(mHouseUIActivated);
-	// ALW - ChatBoxUI::UpdateText() can generate a mCreatePrompt event when an interactive object
-	// ALW - is selected. This asynchronous event will force InteractiveNode classes to ignore
-	// ALW - left and right click events. Then if <enter> is pressed an mEnter event will be
-	// ALW - generated allowing InteractiveNode classes to handle left and right click events.
-	// ALW - However, if another interactive object is selected that occurs before the currently
-	// ALW - selected interactive object in the SceneNode then this newly selected interactive
-	// ALW - object will cause ChatBoxUI::UpdateText() to be called which generates a mCreatePrompt.
-	// ALW - InteractiveNodes are then forced to ignore left and right click events, so the original
-	// ALW - interactive object will be left selected. To remedy this all InteractiveNodes deselect
-	// ALW - themselves when a mCreatePrompt is generated. Immediately afterwards the InteractiveNode
-	// ALW - that generated the mCreatePrompt is reselected.
+	mVoicePool.play(SoundEffects::ID::Object);
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectHouse"));
-	mSelected = true;
 }
 
 void HouseNode::updateOptionsUI()
@@ -230,9 +191,9 @@ void HouseNode::updateOptionsUI()
 
 	// ALW - Tells the HouseUINode whether to draw the UI or not.
 	if (mSelected)
-		InteractiveNode::sendEvent(mDrawHouseUI);
+		InteractiveNode::postEvent(Events::DrawHouseUI);
 	else
-		InteractiveNode::sendEvent(mDoNotDrawHouseUI);
+		InteractiveNode::postEvent(Events::DoNotDrawHouseUI);
 }
 
 void HouseNode::incrementPurchaseBedNet()
@@ -240,7 +201,7 @@ void HouseNode::incrementPurchaseBedNet()
 	if (mDaylightUI.subtract(mNetCost))
 	{
 		++mNewNetCount;
-		calculateNetPurchaseEvent();
+		mRegistry.setBednets(mEntity, getTotalMintNets(), getTotalDamagedNets());
 		updateNetDisableState();
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseNet"));
 	}
@@ -253,7 +214,7 @@ void HouseNode::incrementPurchaseBedNet()
 void HouseNode::decrementPurchaseBedNet()
 {
 	--mNewNetCount;
-	calculateNetRefundEvent();
+	mRegistry.setBednets(mEntity, getTotalMintNets(), getTotalDamagedNets());
 	updateNetDisableState();
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundNet"));
 	mDaylightUI.add(mNetCost);
@@ -264,7 +225,7 @@ void HouseNode::incrementRepair()
 	if (mDaylightUI.subtract(mRepairCost))
 	{
 		++mRepairCount;
-		calculateRepairPurchaseEvent();
+		mRegistry.setBednets(mEntity, getTotalMintNets(), getTotalDamagedNets());
 		updateRepairDisableState();
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseRepair"));
 	}
@@ -277,94 +238,12 @@ void HouseNode::incrementRepair()
 void HouseNode::decrementRepair()
 {
 	--mRepairCount;
-	calculateRepairRefundEvent();
+	mRegistry.setBednets(mEntity, getTotalMintNets(), getTotalDamagedNets());
 	updateRepairDisableState();
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundRepair"));
 	mDaylightUI.add(mRepairCost);
 }
 
-void HouseNode::calculateNetPurchaseEvent()
-{
-	int netCount = mTotalOldNets + mNewNetCount;
-	assert(("The net count is out of range!", 0 <= mNewNetCount && netCount <= mTotalBeds));
-
-	switch (netCount)
-	{
-	case OneNet:
-		InteractiveNode::sendEvent(mAddNet1);
-		break;
-	case TwoNets:
-		InteractiveNode::sendEvent(mAddNet2);
-		break;
-	case ThreeNets:
-		InteractiveNode::sendEvent(mAddNet3);
-		break;
-	default:
-		assert(("The net count is out of range!", false));
-	}
-}
-
-void HouseNode::calculateNetRefundEvent()
-{
-	int netCount = mTotalOldNets + mNewNetCount;
-	assert(("The net count is out of range!", 0 <= mNewNetCount && netCount <= mTotalBeds));
-
-	switch (netCount)
-	{
-	case NoNets:
-		InteractiveNode::sendEvent(mRemoveNet1);
-		break;
-	case OneNet:
-		InteractiveNode::sendEvent(mRemoveNet2);
-		break;
-	case TwoNets:
-		InteractiveNode::sendEvent(mRemoveNet3);
-		break;
-	default:
-		assert(("The net count is out of range!", false));
-	}
-}
-
-void HouseNode::calculateRepairPurchaseEvent()
-{
-	assert(("The repair count is out of range!", 0 <= mRepairCount && mRepairCount <= mTotalOldNets));
-
-	switch (mRepairCount)
-	{
-	case OneNet:
-		InteractiveNode::sendEvent(mRepairNet1);
-		break;
-	case TwoNets:
-		InteractiveNode::sendEvent(mRepairNet2);
-		break;
-	case ThreeNets:
-		InteractiveNode::sendEvent(mRepairNet3);
-		break;
-	default:
-		assert(("The net count is out of range!", false));
-	}
-}
-
-void HouseNode::calculateRepairRefundEvent()
-{
-	assert(("The repair count is out of range!", 0 <= mRepairCount && mRepairCount <= mTotalOldNets));
-
-	switch (mRepairCount)
-	{
-	case NoNets:
-		InteractiveNode::sendEvent(mUnrepairNet1);
-		break;
-	case OneNet:
-		InteractiveNode::sendEvent(mUnrepairNet2);
-		break;
-	case TwoNets:
-		InteractiveNode::sendEvent(mUnrepairNet3);
-		break;
-	default:
-		assert(("The net count is out of range!", false));
-	}
-}
-
 void HouseNode::updateNetDisableState()
 {
 	const int minNewNets = 0;
@@ -5,7 +5,6 @@
 #include "../HUD/houseTrackerUI.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Events/eventStr.h"
 #include "Trambo/Resources/resourceHolder.h"
 
 #include <SFML/Graphics/Rect.hpp>
@@ -30,14 +29,19 @@ namespace trmb
 class ChatBoxUI;
 class DaylightUI;
 class InteractiveObject;
+class MousePicker;
+class Snapshot;
 class UIBundle;
+class VoicePool;
 
 class HouseNode : public BuildingNode // inherits SceneNode, EventHandler, and InteractiveNode indirectly
 {
 public:
 								HouseNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle, std::vector<sf::FloatRect> attachedRects
-									, trmb::FontHolder &fonts, trmb::SoundPlayer &soundPlayer);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+									, trmb::FontHolder &fonts, trmb::SoundPlayer &soundPlayer
+									, VoicePool &voicePool);
 								HouseNode(const HouseNode &) = delete;
 	HouseNode &					operator=(const HouseNode &) = delete;
 
@@ -47,25 +51,15 @@ public:
 	int							getTotalRepairs() const;
 	virtual sf::FloatRect		getBoundingRect() const override;
 
-	void						addInfectedMosquito();
-	void						subtractInfectedMosquito();
+	void						setInfectedMosquitoCount(int count);
+	void						setMosquitoTotal(int total);
 
-	void						addMosquitoTotal();
-	void						subtractMosquitoTotal();
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
 
 	virtual void				handleEvent(const trmb::Event &gameEvent) override final;
 
 
-private:
-	enum NetCount
-	{
-		NoNets    = 0,
-		OneNet    = 1,
-		TwoNets   = 2,
-		ThreeNets = 3
-	};
-
-
 private:
 	virtual void				drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override final;
 	virtual void				updateCurrent(sf::Time dt) override final;
@@ -77,38 +71,17 @@ private:
 	void						incrementRepair();
 	void						decrementRepair();
 
-	void						calculateNetPurchaseEvent();
-	void						calculateNetRefundEvent();
-	void						calculateRepairPurchaseEvent();
-	void						calculateRepairRefundEvent();
 	void						updateNetDisableState();
 	void						updateRepairDisableState();
 
 
 private:
-	const trmb::Event			mHouseUIActivated;
-	const trmb::EventStr		mAddNet1;
-	const trmb::EventStr		mAddNet2;
-	const trmb::EventStr		mAddNet3;
-	const trmb::EventStr		mRemoveNet1;
-	const trmb::EventStr		mRemoveNet2;
-	const trmb::EventStr		mRemoveNet3;
-	const trmb::EventStr		mRepairNet1;
-	const trmb::EventStr		mRepairNet2;
-	const trmb::EventStr		mRepairNet3;
-	const trmb::EventStr		mUnrepairNet1;
-	const trmb::EventStr		mUnrepairNet2;
-	const trmb::EventStr		mUnrepairNet3;
-	const trmb::Event			mDrawHouseUI;
-	const trmb::Event			mDoNotDrawHouseUI;
-	const EventGuid				mLeftClickPress;   // ALW - Matches the GUID in the Controller class.
 	const float					mNetCost;
 	const float					mRepairCost;
-	trmb::SoundPlayer			&mSoundPlayer;
 	HouseTrackerUI				mHouseTrackerUI;
 	DaylightUI					&mDaylightUI;
 	ChatBoxUI					&mChatBoxUI;
-	bool						mHouseUIActive;
+	VoicePool					&mVoicePool;
 
 	const int					mTotalBeds;
 	const int					mTotalOldNets;
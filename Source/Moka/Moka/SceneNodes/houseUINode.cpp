@@ -1,4 +1,5 @@
 #include "houseUINode.h"
+#include "../Application/eventIdentifiers.h"
 #include "../HUD/OptionsUI.h"
 
 #include "Trambo/Events/event.h"
@@ -8,20 +9,18 @@
 
 
 HouseUINode::HouseUINode(const OptionsUI &houseUI)
-: mDrawUI(0xc7353048)
-, mDoNotDrawUI(0x8e6093bf)
-, mUI(houseUI)
+: mUI(houseUI)
 , mIsDrawn(false)
 {
 }
 
 void HouseUINode::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mDrawUI == gameEvent.getType())
+	if (Events::DrawHouseUI == gameEvent.getType())
 	{
 		mIsDrawn = true;
 	}
-	else if (mDoNotDrawUI == gameEvent.getType())
+	else if (Events::DoNotDrawHouseUI == gameEvent.getType())
 	{
 		mIsDrawn = false;
 	}
@@ -1,4 +1,6 @@
 #include "InteractiveNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/eventQueue.h"
 #include "../GameObjects/interactiveObject.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/UndoUI.h"
@@ -12,22 +14,21 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/System/Vector2.hpp>
-#include <SFML/Window/Mouse.hpp>
 
 
 InteractiveNode::InteractiveNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window, const sf::View &view, 
-	UIBundle &uiBundle)
+	UIBundle &uiBundle, const MousePicker &mousePicker, InteractiveRegistry &registry, InteractiveRegistry::Entity entity)
 : mInteractiveObject(interactiveObject)
 , mWindow(window)
 , mView(view)
 , mUIBundle(uiBundle)
+, mMousePicker(mousePicker)
+, mRegistry(registry)
+, mEntity(entity)
 , mSelected(false)
 , mPreviousSelectedState(false)
 , mDisableBuildMode(false)
 , mDisableInput(false)
-, mBeginSimulationEvent(0x5000e550)
-, mCreateTextPrompt(0x25e87fd8)
-, mClearTextPrompt(0xc1523265)
 {
 	setPosition(sf::Vector2f(mInteractiveObject.getX(), mInteractiveObject.getY()));
 
@@ -49,19 +50,21 @@ const InteractiveObject & InteractiveNode::getInteractiveObject() const
 	return mInteractiveObject;
 }
 
+InteractiveRegistry::Entity InteractiveNode::getEntity() const
+{
+	return mEntity;
+}
+
 void InteractiveNode::handleEvent(const trmb::Event& gameEvent)
 {
-	if (mBeginSimulationEvent == gameEvent.getType())
+	if (Events::BeginSimulation == gameEvent.getType())
 	{
 		mDisableBuildMode = true;
 		mSelected = false;
 	}
-	else if (mCreateTextPrompt == gameEvent.getType())
-	{
+	else if (Events::CreateTextPrompt == gameEvent.getType())
 		mDisableInput = true;
-		mSelected = false;
-	}
-	else if (mClearTextPrompt == gameEvent.getType())
+	else if (Events::ClearTextPrompt == gameEvent.getType())
 		mDisableInput = false;
 }
 
@@ -70,23 +73,7 @@ void InteractiveNode::drawCurrent(sf::RenderTarget &target, sf::RenderStates sta
 	// Do nothing by default
 }
 
-bool InteractiveNode::isMouseOverUI(sf::FloatRect rect) const
-{
-	bool ret = false;
-
-	const sf::Vector2i relativeToWindow = sf::Mouse::getPosition(mWindow);
-	const sf::Vector2f relativeToWorld = mWindow.mapPixelToCoords(relativeToWindow, mView);
-	const sf::Vector2f mousePosition = relativeToWorld;
-
-	if (rect.contains(mousePosition))
-	{
-		ret = true;
-	}
-
-	return ret;
-}
-
-void InteractiveNode::sendEvent(const trmb::Event &gameEvent)
+void InteractiveNode::postEvent(EventGuid type)
 {
-	EventHandler::sendEvent(gameEvent);
+	EventQueue::getInstance().post(type);
 }
@@ -1,6 +1,8 @@
 #ifndef INTERACTIVE_NODE_H
 #define INTERACTIVE_NODE_H
 
+#include "../GameObjects/interactiveRegistry.h"
+
 #include "Trambo/Events/eventHandler.h"
 #include "Trambo/SceneNodes/sceneNode.h"
 
@@ -22,6 +24,7 @@ namespace trmb
 }
 
 class InteractiveObject;
+class MousePicker;
 class UIBundle;
 
 class InteractiveNode : public trmb::SceneNode, trmb::EventHandler
@@ -32,25 +35,25 @@ protected:
 
 public:
 								InteractiveNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity);
 								InteractiveNode(const InteractiveNode &) = delete;
 	InteractiveNode &			operator=(const InteractiveNode &) = delete;
 
 	sf::FloatRect				getCollisionBox() const;
 	const InteractiveObject &   getInteractiveObject() const;
+	InteractiveRegistry::Entity	getEntity() const;
 
 	virtual void				handleEvent(const trmb::Event &gameEvent) override;
 
 
 private:
 	virtual void				drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override;
-	virtual bool				isMouseOverObject() const = 0;
 	virtual void				activate() = 0;
 
 
 protected:
-	bool						isMouseOverUI(sf::FloatRect rect) const;
-	void						sendEvent(const trmb::Event &gameEvent);
+	void						postEvent(EventGuid type);	// ALW - Sent by the World at the next dispatch point
 
 
 protected:
@@ -58,6 +61,9 @@ protected:
 	const sf::RenderWindow		&mWindow;
 	const sf::View				&mView;
 	UIBundle					&mUIBundle;
+	const MousePicker			&mMousePicker;
+	InteractiveRegistry			&mRegistry;
+	const InteractiveRegistry::Entity	mEntity;
 	sf::RectangleShape			mHightlight;
 	bool						mSelected;
 	bool						mPreviousSelectedState;
@@ -66,9 +72,6 @@ protected:
 
 
 private:
-	const EventGuid             mBeginSimulationEvent; // ALW - Matches the GUID in the DaylightUI class.
-	const EventGuid				mCreateTextPrompt; // ALW - Matches the GUID in the ChatBoxUI class.
-	const EventGuid				mClearTextPrompt;  // ALW - Matches the GUID in the ChatBoxUI class.
 };
 
 #endif
@@ -0,0 +1,375 @@
+#include "interiorBatch.h"
+#include "clinicNode.h"
+#include "../GameObjects/interactiveGroup.h"
+#include "../GameObjects/interactiveObject.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+
+namespace
+{
+	const std::size_t rectVertices = 6;
+	const std::size_t circleSegments = 30;
+	const std::size_t circleVertices = circleSegments * 3;
+
+	// ALW - A bed is its outline, the pillow, the sheet, and the net, in that order.
+	const std::size_t bedVertices = rectVertices * 4;
+	const std::size_t netOffset = rectVertices * 3;
+
+	// ALW - A resident is its outline and then its fill.
+	const std::size_t residentVertices = circleVertices * 2;
+	const std::size_t residentFillOffset = circleVertices;
+
+	const float tileWidth = 64.0f;
+	const float tileHeight = 64.0f;
+	const float yRowOffset = 15.0f;		// ALW - Beds and residents are listed top to bottom
+
+	const sf::Color black(0u, 0u, 0u, 255u);
+	const sf::Color skin(173u, 145u, 89u, 255u);
+	const sf::Color red(204u, 24u, 32u, 255u);
+	const sf::Color mintNet(0u, 255u, 0u, 150u);		// ALW - Transparent green
+	const sf::Color damagedNet(255u, 0u, 0u, 150u);		// ALW - Transparent red
+
+	sf::IntRect getDoorRect(const InteractiveObject &interactiveObject)
+	{
+		// ALW - Coordinates for a closed door from Tiles.png
+		if ("Tan" == interactiveObject.getColor())
+			return sf::IntRect(896, 640, 64, 64);
+		else if ("Slate" == interactiveObject.getColor())
+			return sf::IntRect(1216, 640, 64, 64);
+
+		throw std::runtime_error("ALW - Runtime Error: Interactive object's color property is not valid.");
+	}
+
+	sf::IntRect getWindowRect(const InteractiveObject &interactiveObject, bool closed)
+	{
+		// ALW - Coordinates for a window from Tiles.png. The closed window is one row below the screened window.
+		const int top = closed ? 704 : 640;
+		int left = 0;
+
+		if ("Tan" == interactiveObject.getColor())
+		{
+			if ("Simple" == interactiveObject.getStyle())
+				left = 832;
+			else if ("Wooden" == interactiveObject.getStyle())
+				left = 768;
+			else
+				throw std::runtime_error("ALW - Runtime Error: Interactive object's style property is not valid.");
+		}
+		else if ("Slate" == interactiveObject.getColor())
+		{
+			if ("Simple" == interactiveObject.getStyle())
+				left = 1152;
+			else if ("Wooden" == interactiveObject.getStyle())
+				left = 1088;
+			else
+				throw std::runtime_error("ALW - Runtime Error: Interactive object's style property is not valid.");
+		}
+		else
+		{
+			throw std::runtime_error("ALW - Runtime Error: Interactive object's color property is not valid.");
+		}
+
+		return sf::IntRect(left, top, 64, 64);
+	}
+
+	sf::IntRect getSupplyRect(int count)
+	{
+		sf::IntRect rect;
+
+		switch (count)
+		{
+		case 1:
+			rect = sf::IntRect(576, 576, 64, 64); // ALW - Coordinates for a small crate from Tiles.png
+			break;
+		case 2:
+			rect = sf::IntRect(512, 576, 64, 64); // ALW - Coordinates for a large crate from Tiles.png
+			break;
+		case 3:
+			rect = sf::IntRect(512, 704, 64, 64); // ALW - Coordinates for a barrel from Tiles.png
+			break;
+		default:
+			assert(("The supply count is out of range!", false));
+		}
+
+		return rect;
+	}
+}
+
+const std::size_t InteriorBatch::noRange = std::numeric_limits<std::size_t>::max();
+
+InteriorBatch::InteriorBatch(const InteractiveGroup &interactiveGroup, const InteractiveRegistry &registry, const sf::Texture &tiles)
+: mInteractiveObjects(interactiveGroup.getInteractiveObjects())
+, mRegistry(registry)
+, mTiles(tiles)
+, mClinic(nullptr)
+, mSprites(sf::Triangles)
+, mShapes(sf::Triangles)
+, mFirstSprite(registry.getEntityCount(), noRange)
+, mFirstBed(registry.getEntityCount(), noRange)
+, mFirstResident(registry.getEntityCount(), noRange)
+, mPlanRevision(registry.getPlanRevision())
+, mShownRDTs(0)
+, mShownACTs(0)
+{
+	assert(("The registry and the interactive group disagree!", mInteractiveObjects.size() == registry.getEntityCount()));
+
+	for (InteractiveRegistry::Entity entity = 0; entity < mInteractiveObjects.size(); ++entity)
+	{
+		const InteractiveObject &interactiveObject = mInteractiveObjects[entity];
+		const sf::Vector2f position(interactiveObject.getAlternateXCoord1(), interactiveObject.getAlternateYCoord1());
+
+		switch (registry.getKind(entity))
+		{
+		case InteractiveRegistry::Kind::Barrel:
+			mFirstSprite[entity] = mSprites.getVertexCount();
+			addSprite(mSprites, position);
+			setTextureRect(mSprites, mFirstSprite[entity], sf::IntRect(576, 640, 64, 64)); // ALW - Coordinates for a barrel with lid from Tiles.png
+			break;
+		case InteractiveRegistry::Kind::Door:
+			mFirstSprite[entity] = mSprites.getVertexCount();
+			addSprite(mSprites, position);
+			setTextureRect(mSprites, mFirstSprite[entity], getDoorRect(interactiveObject));
+			break;
+		case InteractiveRegistry::Kind::Window:
+			mFirstSprite[entity] = mSprites.getVertexCount();
+			addSprite(mSprites, position);
+			getWindowRect(interactiveObject, true); // ALW - Fail on a bad color or style while the map is loading
+			break;
+		case InteractiveRegistry::Kind::Clinic:
+			// ALW - The RDTs, then the ACTs
+			mFirstSprite[entity] = mSprites.getVertexCount();
+			addSprite(mSprites, position);
+			addSprite(mSprites, sf::Vector2f(interactiveObject.getAlternateXCoord2(), interactiveObject.getAlternateYCoord2()));
+			break;
+		case InteractiveRegistry::Kind::House:
+			addBeds(interactiveObject, entity);
+			addResidents(interactiveObject, entity);
+			break;
+		default:
+			break;
+		}
+	}
+
+	// ALW - Everything starts hidden. The clinic's supplies are shown once setClinic() is called.
+	patchPreventions();
+}
+
+void InteriorBatch::setClinic(const ClinicNode &clinic)
+{
+	mClinic = &clinic;
+	patchClinic();
+}
+
+void InteriorBatch::setResidentInfected(InteractiveRegistry::Entity house, std::size_t residentID, bool infected)
+{
+	assert(("The entity is not a house!", noRange != mFirstResident[house]));
+	assert(("The resident ID is out of range!", static_cast<int>(residentID) < mInteractiveObjects[house].getResidents()));
+
+	const std::size_t first = mFirstResident[house] + residentID * residentVertices + residentFillOffset;
+	setColor(mShapes, first, circleVertices, infected ? red : skin);
+}
+
+void InteriorBatch::updateCurrent(sf::Time)
+{
+	if (mRegistry.getPlanRevision() != mPlanRevision)
+	{
+		mPlanRevision = mRegistry.getPlanRevision();
+		patchPreventions();
+	}
+
+	if (mClinic && (mClinic->getTotalRDTs() != mShownRDTs || mClinic->getTotalACTs() != mShownACTs))
+		patchClinic();
+}
+
+void InteriorBatch::drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const
+{
+	sf::RenderStates spriteStates(states);
+	spriteStates.texture = &mTiles;
+
+	target.draw(mSprites, spriteStates);
+	target.draw(mShapes, states);
+}
+
+void InteriorBatch::addBeds(const InteractiveObject &interactiveObject, InteractiveRegistry::Entity entity)
+{
+	const int maxBeds = 3;
+	const int totalBeds = interactiveObject.getBeds();
+	assert(("ALW - Logic Error: The interactive object's Beds property is out of range (0-3 are legal)!", 0 <= totalBeds && totalBeds <= maxBeds));
+
+	const sf::Vector2f bedPosition(interactiveObject.getX() + interactiveObject.getAlternateXCoord2()
+		, interactiveObject.getY() + interactiveObject.getAlternateYCoord2());
+	const sf::Vector2f bedSize(20.0f, 10.0f);
+	const sf::Vector2f sheetSize(16.0f, 10.0f);
+	const float sheetOffset = 4.0f;
+	const float outlineThickness = 1.0f;
+
+	mFirstBed[entity] = mShapes.getVertexCount();
+	for (int bed = 0; bed < totalBeds; ++bed)
+	{
+		const sf::Vector2f position(bedPosition.x, bedPosition.y + yRowOffset * bed);
+
+		addRect(mShapes, sf::FloatRect(position.x - outlineThickness, position.y - outlineThickness
+			, bedSize.x + outlineThickness * 2.0f, bedSize.y + outlineThickness * 2.0f), black);
+		addRect(mShapes, sf::FloatRect(position, bedSize), sf::Color(255u, 255u, 255u, 255u));	// ALW - White "pillow"
+		addRect(mShapes, sf::FloatRect(sf::Vector2f(position.x + sheetOffset, position.y), sheetSize)
+			, sf::Color(128u, 128u, 128u, 255u));												// ALW - Grey
+		addRect(mShapes, sf::FloatRect(position, bedSize), sf::Color::Transparent);
+	}
+}
+
+void InteriorBatch::addResidents(const InteractiveObject &interactiveObject, InteractiveRegistry::Entity entity)
+{
+	const float radius = 5.0f;
+	const float outlineThickness = 1.0f;
+	const sf::Vector2f uiPosition(interactiveObject.getX() + interactiveObject.getAlternateXCoord1()
+		, interactiveObject.getY() + interactiveObject.getAlternateYCoord1());
+
+	mFirstResident[entity] = mShapes.getVertexCount();
+	for (int resident = 0; resident < interactiveObject.getResidents(); ++resident)
+	{
+		const sf::Vector2f center(uiPosition.x + radius, uiPosition.y + radius + yRowOffset * resident);
+		addCircle(mShapes, center, radius + outlineThickness, black);
+		addCircle(mShapes, center, radius, skin);
+	}
+}
+
+void InteriorBatch::patchPreventions()
+{
+	for (InteractiveRegistry::Entity entity = 0; entity < mInteractiveObjects.size(); ++entity)
+	{
+		const InteractiveRegistry::Prevention &prevention = mRegistry.getPrevention(entity);
+
+		switch (mRegistry.getKind(entity))
+		{
+		case InteractiveRegistry::Kind::Barrel:
+			setColor(mSprites, mFirstSprite[entity], rectVertices, prevention.covered ? sf::Color::White : sf::Color::Transparent);
+			break;
+		case InteractiveRegistry::Kind::Door:
+			setColor(mSprites, mFirstSprite[entity], rectVertices, prevention.closed ? sf::Color::White : sf::Color::Transparent);
+			break;
+		case InteractiveRegistry::Kind::Window:
+			// ALW - If the window is closed then the screen is not visible.
+			if (prevention.closed || prevention.screened)
+				setTextureRect(mSprites, mFirstSprite[entity], getWindowRect(mInteractiveObjects[entity], prevention.closed));
+
+			setColor(mSprites, mFirstSprite[entity], rectVertices
+				, prevention.closed || prevention.screened ? sf::Color::White : sf::Color::Transparent);
+			break;
+		case InteractiveRegistry::Kind::House:
+			patchNets(mInteractiveObjects[entity], entity);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+void InteriorBatch::patchNets(const InteractiveObject &interactiveObject, InteractiveRegistry::Entity entity)
+{
+	// ALW - Nets fill the beds from the top. The house starts with its old, damaged nets. A repair fixes the
+	// ALW - topmost damaged net, and a new net goes on the next empty bed.
+	const InteractiveRegistry::Bednets &bednets = mRegistry.getBednets(entity);
+	const int oldNets = interactiveObject.getNets();
+	const int repairs = oldNets - bednets.damaged;
+	const int nets = bednets.mint + bednets.damaged;
+
+	for (int bed = 0; bed < interactiveObject.getBeds(); ++bed)
+	{
+		sf::Color color = sf::Color::Transparent;
+		if (bed < nets)
+			color = (bed < repairs || oldNets <= bed) ? mintNet : damagedNet;
+
+		setColor(mShapes, mFirstBed[entity] + bed * bedVertices + netOffset, rectVertices, color);
+	}
+}
+
+void InteriorBatch::patchClinic()
+{
+	assert(("The clinic is not set!", mClinic != nullptr));
+
+	mShownRDTs = mClinic->getTotalRDTs();
+	mShownACTs = mClinic->getTotalACTs();
+
+	const InteractiveRegistry::Entity clinic = mRegistry.getEntities(InteractiveRegistry::Kind::Clinic).front();
+	const std::size_t firstRDT = mFirstSprite[clinic];
+	const std::size_t firstACT = firstRDT + rectVertices;
+
+	if (mShownRDTs > 0)
+		setTextureRect(mSprites, firstRDT, getSupplyRect(mShownRDTs));
+
+	if (mShownACTs > 0)
+		setTextureRect(mSprites, firstACT, getSupplyRect(mShownACTs));
+
+	setColor(mSprites, firstRDT, rectVertices, mShownRDTs > 0 ? sf::Color::White : sf::Color::Transparent);
+	setColor(mSprites, firstACT, rectVertices, mShownACTs > 0 ? sf::Color::White : sf::Color::Transparent);
+}
+
+void InteriorBatch::addRect(sf::VertexArray &vertices, sf::FloatRect rect, sf::Color color)
+{
+	const sf::Vector2f topLeft(rect.left, rect.top);
+	const sf::Vector2f topRight(rect.left + rect.width, rect.top);
+	const sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+	const sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+
+	vertices.append(sf::Vertex(topLeft, color));
+	vertices.append(sf::Vertex(topRight, color));
+	vertices.append(sf::Vertex(bottomRight, color));
+	vertices.append(sf::Vertex(topLeft, color));
+	vertices.append(sf::Vertex(bottomRight, color));
+	vertices.append(sf::Vertex(bottomLeft, color));
+}
+
+void InteriorBatch::addSprite(sf::VertexArray &vertices, sf::Vector2f position)
+{
+	addRect(vertices, sf::FloatRect(position, sf::Vector2f(tileWidth, tileHeight)), sf::Color::Transparent);
+}
+
+void InteriorBatch::addCircle(sf::VertexArray &vertices, sf::Vector2f center, float radius, sf::Color color)
+{
+	const float pi = 3.141592654f;
+
+	for (std::size_t segment = 0; segment < circleSegments; ++segment)
+	{
+		const float start = 2.0f * pi * segment / circleSegments;
+		const float end = 2.0f * pi * (segment + 1) / circleSegments;
+
+		vertices.append(sf::Vertex(center, color));
+		vertices.append(sf::Vertex(center + sf::Vector2f(std::cos(start), std::sin(start)) * radius, color));
+		vertices.append(sf::Vertex(center + sf::Vector2f(std::cos(end), std::sin(end)) * radius, color));
+	}
+}
+
+void InteriorBatch::setColor(sf::VertexArray &vertices, std::size_t first, std::size_t count, sf::Color color)
+{
+	assert(("The range is out of bounds!", first + count <= vertices.getVertexCount()));
+
+	for (std::size_t i = first; i < first + count; ++i)
+		vertices[i].color = color;
+}
+
+void InteriorBatch::setTextureRect(sf::VertexArray &vertices, std::size_t first, sf::IntRect textureRect)
+{
+	assert(("The range is out of bounds!", first + rectVertices <= vertices.getVertexCount()));
+
+	const float left = static_cast<float>(textureRect.left);
+	const float top = static_cast<float>(textureRect.top);
+	const float right = static_cast<float>(textureRect.left + textureRect.width);
+	const float bottom = static_cast<float>(textureRect.top + textureRect.height);
+
+	// ALW - Matches the corner order of addRect().
+	vertices[first + 0].texCoords = sf::Vector2f(left, top);
+	vertices[first + 1].texCoords = sf::Vector2f(right, top);
+	vertices[first + 2].texCoords = sf::Vector2f(right, bottom);
+	vertices[first + 3].texCoords = sf::Vector2f(left, top);
+	vertices[first + 4].texCoords = sf::Vector2f(right, bottom);
+	vertices[first + 5].texCoords = sf::Vector2f(left, bottom);
+}
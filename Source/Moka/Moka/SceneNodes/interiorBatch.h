@@ -0,0 +1,86 @@
+#ifndef INTERIOR_BATCH_H
+#define INTERIOR_BATCH_H
+
+#include "../GameObjects/interactiveRegistry.h"
+
+#include "Trambo/SceneNodes/sceneNode.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+	class RenderStates;
+	class RenderTarget;
+	class Texture;
+}
+
+class ClinicNode;
+class InteractiveGroup;
+class InteractiveObject;
+
+// ALW - The house interiors (beds, sheets, nets, and residents) and the prevention sprites (barrel covers, closed
+// ALW - doors, closed and screened windows, and clinic supplies) baked into two vertex arrays, one textured with
+// ALW - the tiles and one untextured, so the whole Update layer is two draw calls. Every object owns a fixed
+// ALW - range of vertices. A range is only patched when its state changes: the registry's plan revision for
+// ALW - the preventions and nets, the clinic's supply counts, and setResidentInfected() for the residents.
+// ALW - Something hidden keeps its range and is made transparent.
+class InteriorBatch : public trmb::SceneNode
+{
+public:
+								InteriorBatch(const InteractiveGroup &interactiveGroup, const InteractiveRegistry &registry
+									, const sf::Texture &tiles);
+								InteriorBatch(const InteriorBatch &) = delete;
+	InteriorBatch &				operator=(const InteriorBatch &) = delete;
+
+	void						setClinic(const ClinicNode &clinic);
+	void						setResidentInfected(InteractiveRegistry::Entity house, std::size_t residentID, bool infected);
+
+
+private:
+	static const std::size_t	noRange;
+
+
+private:
+	virtual void				updateCurrent(sf::Time dt) override;
+	virtual void				drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override;
+
+	void						addBeds(const InteractiveObject &interactiveObject, InteractiveRegistry::Entity entity);
+	void						addResidents(const InteractiveObject &interactiveObject, InteractiveRegistry::Entity entity);
+
+	void						patchPreventions();
+	void						patchNets(const InteractiveObject &interactiveObject, InteractiveRegistry::Entity entity);
+	void						patchClinic();
+
+	static void					addRect(sf::VertexArray &vertices, sf::FloatRect rect, sf::Color color);
+	static void					addSprite(sf::VertexArray &vertices, sf::Vector2f position);
+	static void					addCircle(sf::VertexArray &vertices, sf::Vector2f center, float radius, sf::Color color);
+	static void					setColor(sf::VertexArray &vertices, std::size_t first, std::size_t count, sf::Color color);
+	static void					setTextureRect(sf::VertexArray &vertices, std::size_t first, sf::IntRect textureRect);
+
+
+private:
+	const std::vector<InteractiveObject>	&mInteractiveObjects;
+	const InteractiveRegistry				&mRegistry;
+	const sf::Texture						&mTiles;
+	const ClinicNode						*mClinic;
+
+	sf::VertexArray							mSprites;			// ALW - Textured with the tiles
+	sf::VertexArray							mShapes;
+	std::vector<std::size_t>				mFirstSprite;		// ALW - Indexed by entity. The clinic owns two sprites.
+	std::vector<std::size_t>				mFirstBed;			// ALW - Indexed by entity
+	std::vector<std::size_t>				mFirstResident;		// ALW - Indexed by entity
+
+	std::size_t								mPlanRevision;
+	int										mShownRDTs;
+	int										mShownACTs;
+};
+
+#endif
@@ -1,59 +1,50 @@
 #include "mosquitoNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "swarmClock.h"
 #include "../Resources/resourceIdentifiers.h"
+#include "../Simulation/simulationRandom.h"
+#include "../Simulation/snapshot.h"
+#include "../Simulation/transmissionRates.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Utilities/utility.h"
 
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
 #include <cassert>
+#include <functional>
 #include <vector>
 
 
 MosquitoNode::MosquitoNode(const trmb::TextureHolder& textures, sf::Vector2f position, bool active, sf::FloatRect worldBounds
-	, SceneNode &houseLayer)
-: mBeginSimulationEvent(0x5000e550)
-, mBeginScoreboardEvent(0xf5e88b6e)
-, mCreateTextPrompt(0x25e87fd8)
-, mClearTextPrompt(0xc1523265)
-, mTextures(textures)
+	, const HouseTileMask &houseTileMask, const FlowField &flowField, EventScheduler &scheduler, const SwarmClock &swarmClock)
+: mTextures(textures)
 , mWorldBounds(worldBounds)
-, mHouseLayer(houseLayer)
-, mAnimation(textures.get(Textures::ID::MosquitoAnimation))
+, mHouseTileMask(houseTileMask)
+, mFlowField(flowField)
+, mScheduler(scheduler)
+, mSwarmClock(swarmClock)
+, mPhase(SwarmClock::getPhase(position))
 , mPreviousPosition()
 , mHasMalaria(false)
 , mIndoor(false)
 , mSimulationMode(false)
-, mPause(false)
-, mDelaySet(false)
 , mActive(active)
-, mTotalDelayTime()
-, mUpdateDelayTime()
+, mDormant(false)
 , mTotalMovementTime(sf::seconds(1.0))
-, mUpdateMovementTime()
-, mRandomDevice()				// ALW - obtain random number from hardware
-, mGenerator(mRandomDevice())	// ALW - Seed the generator
-, mWeightedDistribution()
+, mActivationEvent(EventScheduler::noEvent)
+, mMovementEvent(EventScheduler::noEvent)
+, mWeightedDistribution(getSpawnDelayDistribution())
 {
 	setPosition(position);
 
-	mAnimation.setFrameSize(sf::Vector2i(64, 64));
-	mAnimation.setNumFrames(8);
-	mAnimation.setDuration(sf::seconds(1));
-	mAnimation.setRepeating(true);
-
 	if (mActive)
 	{
 		// ALW - A Mosquito will only spawn already active during the simulation mode.
 		mSimulationMode = true;
+		scheduleMovement(mTotalMovementTime);
 	}
-
-	// ALW - Change the range and weights 
-	std::vector<float> intervals = { 0, 1, 2, 3 };
-	std::vector<float> weights   = { 0.05f, 0.1f, 0.20f };
-	decltype(mWeightedDistribution.param()) new_range(intervals.begin(), intervals.end(), weights.begin());
-	mWeightedDistribution.param(new_range);
 }
 
 sf::FloatRect MosquitoNode::getBoundingRect() const
@@ -61,6 +52,10 @@ sf::FloatRect MosquitoNode::getBoundingRect() const
 	const float tileWidth = 64;
 	const float tileHeight = 64;
 
+	// ALW - An empty rect never intersects, so dormant mosquitoes are skipped by the collision checks.
+	if (mDormant)
+		return sf::FloatRect();
+
 	return sf::FloatRect(getPosition().x, getPosition().y, tileWidth, tileHeight);
 }
 
@@ -74,6 +69,19 @@ bool MosquitoNode::isIndoor() const
 	return mIndoor;
 }
 
+bool MosquitoNode::isDormant() const
+{
+	return mDormant;
+}
+
+sf::Time MosquitoNode::getRemainingDelay() const
+{
+	if (!mScheduler.isPending(mActivationEvent))
+		return sf::Time::Zero;
+
+	return mScheduler.getTimeUntil(mActivationEvent);
+}
+
 void MosquitoNode::setIndoor(bool indoors)
 {
 	mIndoor = indoors;
@@ -82,125 +90,156 @@ void MosquitoNode::setIndoor(bool indoors)
 void MosquitoNode::contractMalaria()
 {
 	mHasMalaria = true;
-	mAnimation.setTexture(mTextures.get(Textures::ID::InfectedMosquitoAnimation));
 }
 
-void MosquitoNode::updateCurrent(sf::Time dt)
+void MosquitoNode::spawn(sf::Vector2f position)
 {
-	// ALW - Simulation Mode
-	if (mSimulationMode)
-	{
-		if (!mPause)
-		{
-			if (mDelaySet)
-				delaySpawn(dt);
+	// ALW - Reset to the state of a freshly constructed mosquito that spawns already active.
+	setPosition(position);
+	mPhase = SwarmClock::getPhase(position);
+	mPreviousPosition = sf::Vector2f();
+	mHasMalaria = false;
+	mIndoor = false;
+	mSimulationMode = true;
+	mActive = true;
+	mDormant = false;
+	scheduleMovement(mTotalMovementTime);
+}
 
-			if (mActive)
-			{
-				setNextPosition(dt);
-				mAnimation.update(dt);
-			}
-		}
-	}
+void MosquitoNode::despawn()
+{
+	mScheduler.cancel(mActivationEvent);
+	mScheduler.cancel(mMovementEvent);
+	mActivationEvent = EventScheduler::noEvent;
+	mMovementEvent = EventScheduler::noEvent;
+	mActive = false;
+	mDormant = true;
+}
+
+void MosquitoNode::save(Snapshot &snapshot) const
+{
+	snapshot.write(getPosition());
+	snapshot.write(mPreviousPosition);
+	snapshot.write(mPhase);				// ALW - Follows the spawn position, which the current position no longer gives
+	snapshot.write(mHasMalaria);
+	snapshot.write(mIndoor);
+	snapshot.write(mSimulationMode);
+	snapshot.write(mActive);
+	snapshot.write(mDormant);
+	mScheduler.save(snapshot, mActivationEvent);
+	mScheduler.save(snapshot, mMovementEvent);
+}
+
+void MosquitoNode::load(Snapshot &snapshot)
+{
+	sf::Vector2f position;
+	snapshot.read(position);
+	setPosition(position);
+
+	snapshot.read(mPreviousPosition);
+	snapshot.read(mPhase);
+	snapshot.read(mHasMalaria);
+	snapshot.read(mIndoor);
+	snapshot.read(mSimulationMode);
+	snapshot.read(mActive);
+	snapshot.read(mDormant);
+	mActivationEvent = mScheduler.load(snapshot, mActivationEvent, std::bind(&MosquitoNode::activate, this));
+	mMovementEvent = mScheduler.load(snapshot, mMovementEvent, std::bind(&MosquitoNode::setNextPosition, this));
+}
+
+void MosquitoNode::updateCurrent(sf::Time)
+{
+	// ALW - The spawn delay and movement are scheduled events, and the animation frame comes from the
+	// ALW - SwarmClock when drawn, so there is nothing to update every frame.
 }
 
 void MosquitoNode::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mBeginSimulationEvent == gameEvent.getType())
+	if (Events::BeginSimulation == gameEvent.getType())
 	{
 		mSimulationMode = true;
-		delaySpawn(sf::seconds(0));	// ALW - Each time after this method will be fed the time delta
+
+		if (!mDormant && !mActive)
+			scheduleActivation(sf::seconds(getDelay()));
 	}
-	else if (mBeginScoreboardEvent == gameEvent.getType())
+	else if (Events::BeginScoreboard == gameEvent.getType())
 	{
 		mSimulationMode = false;
 	}
-	else if (mCreateTextPrompt == gameEvent.getType())
-	{
-		mPause = true;
-	}
-	else if (mClearTextPrompt == gameEvent.getType())
-	{
-		mPause = false;
-	}
 }
 
 void MosquitoNode::drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const
 {
-	if (mActive && !mIndoor)
-		target.draw(mAnimation, states);
+	if (mActive && !mIndoor && !mDormant)
+	{
+		const sf::Texture &texture = mTextures.get(mHasMalaria ? Textures::ID::InfectedMosquitoAnimation
+			: Textures::ID::MosquitoAnimation);
+		target.draw(sf::Sprite(texture, mSwarmClock.getFrameRect(texture, mPhase)), states);
+	}
 }
 
-void MosquitoNode::setNextPosition(sf::Time dt)
+void MosquitoNode::setNextPosition()
 {
-	mUpdateMovementTime += dt;
+	scheduleMovement(mTotalMovementTime);
 
-	if (mUpdateMovementTime >= mTotalMovementTime)
-	{
-		mUpdateMovementTime -= mTotalMovementTime;
+	sf::Vector2f position;
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	const int direction = mFlowField.getDirection(getPosition(), SimulationRandom::getInstance().randomInt(FlowField::rollRange));
+	assert(("The direction is invalid", 0 <= direction && direction < Direction::Count));
 
-		sf::Vector2f position;
-		const float tileWidth = 64;
-		const float tileHeight = 64;
-		const int direction = trmb::randomInt(Direction::Count);
-		assert(("The direction is invalid", 0 <= direction && direction < Direction::Count));
+	switch (direction)
+	{
+	case Direction::Up:
+		position = getPosition() - sf::Vector2f(0, tileHeight);
+		break;
+	case Direction::Down:
+		position = getPosition() + sf::Vector2f(0, tileHeight);
+		break;
+	case Direction::Left:
+		position = getPosition() - sf::Vector2f(tileWidth, 0);
+		break;
+	case Direction::Right:
+		position = getPosition() + sf::Vector2f(tileWidth, 0);
+		break;
+	}
 
-		switch (direction)
-		{
-		case Direction::Up:
-			position = getPosition() - sf::Vector2f(0, tileHeight);
-			break;
-		case Direction::Down:
-			position = getPosition() + sf::Vector2f(0, tileHeight);
-			break;
-		case Direction::Left:
-			position = getPosition() - sf::Vector2f(tileWidth, 0);
-			break;
-		case Direction::Right:
-			position = getPosition() + sf::Vector2f(tileWidth, 0);
-			break;
-		}
+	if (mWorldBounds.left <= position.x && mWorldBounds.width > position.x
+		&& mWorldBounds.top <= position.y && mWorldBounds.height > position.y)
+	{
+		// ALW - The position is within the world bounds
+		mPreviousPosition = getPosition();
+		setPosition(position);
 
-		if (mWorldBounds.left <= position.x && mWorldBounds.width > position.x
-			&& mWorldBounds.top <= position.y && mWorldBounds.height > position.y)
+		if (mIndoor)
 		{
-			// ALW - The position is within the world bounds
-			mPreviousPosition = getPosition();
-			setPosition(position);
-
-			if (mIndoor)
+			// ALW - Verify indoor mosquito is inside a house's boundaries
+			if (!mHouseTileMask.isIndoor(position))
 			{
-				// ALW - Verify indoor mosquito is inside a house's boundaries
-				std::set<trmb::SceneNode::Pair> collisionPairs;
-				this->checkSceneCollision(mHouseLayer, collisionPairs);
-
-				if (!collisionPairs.size())
-				{
-					// ALW - There were no collisions between the mosquito and a house. Revert the position.
-					setPosition(mPreviousPosition);
-				}
+				// ALW - The new tile is not inside a house. Revert the position.
+				setPosition(mPreviousPosition);
 			}
 		}
 	}
 }
 
-void MosquitoNode::delaySpawn(sf::Time dt)
+void MosquitoNode::scheduleMovement(sf::Time delay)
 {
-	if (!mDelaySet)
-	{
-		mTotalDelayTime = sf::seconds(getDelay());
-		mDelaySet = true;
-	}
+	mMovementEvent = mScheduler.schedule(delay, std::bind(&MosquitoNode::setNextPosition, this));
+}
 
-	mUpdateDelayTime += dt;
+void MosquitoNode::scheduleActivation(sf::Time delay)
+{
+	mActivationEvent = mScheduler.schedule(delay, std::bind(&MosquitoNode::activate, this));
+}
 
-	if (mUpdateDelayTime >= mTotalDelayTime)
-	{
-		mActive = true;
-	}
+void MosquitoNode::activate()
+{
+	mActive = true;
+	scheduleMovement(mTotalMovementTime);
 }
 
 float MosquitoNode::getDelay()
 {
-	return mWeightedDistribution(mGenerator);
+	return mWeightedDistribution(SimulationRandom::getInstance().getGenerator());
 }
@@ -1,7 +1,10 @@
 #ifndef MOSQUITO_NODE_H
 #define MOSQUITO_NODE_H
 
-#include "Trambo/Animations/animation.h"
+#include "../GameObjects/flowField.h"
+#include "../GameObjects/houseTileMask.h"
+#include "../Simulation/eventScheduler.h"
+
 #include "Trambo/Events/eventHandler.h"
 #include "Trambo/SceneNodes/sceneNode.h"
 #include "Trambo/Resources/resourceHolder.h"
@@ -10,6 +13,8 @@
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <random>
 
 
@@ -24,22 +29,33 @@ namespace trambo
 	class Event;
 }
 
+class Snapshot;
+class SwarmClock;
+
 class MosquitoNode : public trmb::SceneNode, trmb::EventHandler
 {
 public:
 								MosquitoNode(const trmb::TextureHolder &textures, sf::Vector2f position, bool active
-									, sf::FloatRect worldBounds, SceneNode &houseLayer);
+									, sf::FloatRect worldBounds, const HouseTileMask &houseTileMask, const FlowField &flowField
+									, EventScheduler &scheduler, const SwarmClock &swarmClock);
 								MosquitoNode(const MosquitoNode &) = delete;
 	MosquitoNode &				operator=(const MosquitoNode &) = delete;
 
 	bool						hasMalaria() const;
 	bool						isIndoor() const;
+	bool						isDormant() const;
+	sf::Time					getRemainingDelay() const;	// ALW - Zero once the mosquito starts to move
 
 	virtual sf::FloatRect		getBoundingRect() const override;
 
 	void						setIndoor(bool indoors);
 
 	void						contractMalaria();
+	void						spawn(sf::Vector2f position);
+	void						despawn();
+
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
 
 	virtual void				updateCurrent(sf::Time dt) override final;
 	virtual void				handleEvent(const trmb::Event &gameEvent) override final;
@@ -56,42 +72,35 @@ private:
 	};
 
 
-private:
-	using						EventGuid = unsigned long;
-
-
 private:
 	virtual void				drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override;
-	void						setNextPosition(sf::Time dt);
-	void						delaySpawn(sf::Time dt);
+	void						setNextPosition();
+	void						scheduleMovement(sf::Time delay);
+	void						scheduleActivation(sf::Time delay);
+	void						activate();
 	float						getDelay();
 
 
 private:
-	const EventGuid				mBeginSimulationEvent;   // ALW - Matches the GUID in the DaylightUI class.
-	const EventGuid				mBeginScoreboardEvent;   // ALW - Matches the GUID in the World class.
-	const EventGuid				mCreateTextPrompt;		 // ALW - Matches the GUID in the ChatBoxUI class.
-	const EventGuid				mClearTextPrompt;		 // ALW - Matches the GUID in the ChatBoxUI class.
 	const trmb::TextureHolder	&mTextures;
 	const sf::FloatRect			mWorldBounds;
-	trmb::SceneNode				&mHouseLayer;
-	trmb::Animation				mAnimation;
+	const HouseTileMask			&mHouseTileMask;
+	const FlowField				&mFlowField;
+	EventScheduler				&mScheduler;
+	const SwarmClock			&mSwarmClock;
+	std::uint8_t				mPhase;				// ALW - Offset into the SwarmClock's loop
 	sf::Vector2f				mPreviousPosition;
 	bool						mHasMalaria;
 	bool						mIndoor;
 
 	bool						mSimulationMode;
-	bool						mPause;
-	bool						mDelaySet;
 	bool						mActive;
+	bool						mDormant;			// ALW - Parked in the MosquitoPool. Not updated, drawn, or collided with.
 
-	sf::Time					mTotalDelayTime;
-	sf::Time					mUpdateDelayTime;
-	sf::Time					mTotalMovementTime;
-	sf::Time					mUpdateMovementTime;
+	const sf::Time				mTotalMovementTime;
+	EventScheduler::EventID		mActivationEvent;	// ALW - Pending until the spawn delay has passed
+	EventScheduler::EventID		mMovementEvent;
 
-	std::random_device			mRandomDevice;
-	std::mt19937				mGenerator;
 	std::piecewise_constant_distribution<float>	mWeightedDistribution;
 };
 
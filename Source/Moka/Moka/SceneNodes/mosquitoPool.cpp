@@ -0,0 +1,124 @@
+#include "mosquitoPool.h"
+#include "culledLayerNode.h"
+#include "mosquitoNode.h"
+#include "../Simulation/snapshot.h"
+
+#include "Trambo/SceneNodes/sceneNode.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+
+MosquitoPool::MosquitoPool(const trmb::TextureHolder &textures, sf::FloatRect worldBounds, const HouseTileMask &houseTileMask
+	, const FlowField &flowField, EventScheduler &scheduler, const SwarmClock &swarmClock)
+: mTextures(textures)
+, mWorldBounds(worldBounds)
+, mHouseTileMask(houseTileMask)
+, mFlowField(flowField)
+, mScheduler(scheduler)
+, mSwarmClock(swarmClock)
+, mLayer(nullptr)
+, mMosquitoes()
+, mFreeList()
+, mStatistics()
+{
+}
+
+const MosquitoPool::Statistics & MosquitoPool::getStatistics() const
+{
+	return mStatistics;
+}
+
+const std::vector<MosquitoNode *> & MosquitoPool::getMosquitoes() const
+{
+	return mMosquitoes;
+}
+
+void MosquitoPool::initialize(CulledLayerNode &layer, std::size_t capacity)
+{
+	assert(("The mosquito pool is already initialized!", mLayer == nullptr));
+	mLayer = &layer;
+
+	mMosquitoes.reserve(capacity);
+	mFreeList.reserve(capacity);
+
+	for (std::size_t i = 0; i < capacity; ++i)
+		allocate();
+
+	// ALW - Only count the allocations that happen after the pool is ready.
+	mStatistics.allocations = 0;
+}
+
+MosquitoNode & MosquitoPool::acquire(sf::Vector2f position)
+{
+	assert(("The mosquito pool is not initialized!", mLayer != nullptr));
+
+	if (mFreeList.empty())
+		allocate();
+
+	const std::size_t poolID = mFreeList.back();
+	mFreeList.pop_back();
+
+	MosquitoNode &mosquito = *mMosquitoes[poolID];
+	mosquito.spawn(position);
+
+	++mStatistics.acquisitions;
+	++mStatistics.active;
+	mStatistics.highWaterMark = std::max(mStatistics.highWaterMark, mStatistics.active);
+
+	return mosquito;
+}
+
+void MosquitoPool::save(Snapshot &snapshot) const
+{
+	snapshot.write(mMosquitoes.size());
+
+	for (const MosquitoNode * const mosquito : mMosquitoes)
+		mosquito->save(snapshot);
+}
+
+void MosquitoPool::load(Snapshot &snapshot)
+{
+	assert(("The mosquito pool is not initialized!", mLayer != nullptr));
+
+	std::size_t count = 0;
+	snapshot.read(count);
+
+	// ALW - Grow to the size the pool had when the snapshot was taken. Allocations are counted like any other,
+	// ALW - since a pool this size would have run dry at some point during that night too.
+	while (mMosquitoes.size() < count)
+		allocate();
+
+	for (std::size_t poolID = 0; poolID < count; ++poolID)
+		mMosquitoes[poolID]->load(snapshot);
+
+	for (std::size_t poolID = count; poolID < mMosquitoes.size(); ++poolID)
+		mMosquitoes[poolID]->despawn();
+
+	mFreeList.clear();
+	mStatistics.active = 0;
+	for (std::size_t poolID = 0; poolID < mMosquitoes.size(); ++poolID)
+	{
+		if (mMosquitoes[poolID]->isDormant())
+			mFreeList.push_back(poolID);
+		else
+			++mStatistics.active;
+	}
+
+	mStatistics.highWaterMark = std::max(mStatistics.highWaterMark, mStatistics.active);
+}
+
+void MosquitoPool::allocate()
+{
+	std::unique_ptr<MosquitoNode> mosquito(new MosquitoNode(mTextures, sf::Vector2f(), false, mWorldBounds, mHouseTileMask
+		, mFlowField, mScheduler, mSwarmClock));
+	mosquito->despawn();
+
+	mFreeList.push_back(mMosquitoes.size());
+	mMosquitoes.push_back(mosquito.get());
+	mLayer->attachMovingChild(std::move(mosquito));
+
+	++mStatistics.allocations;
+	++mStatistics.capacity;
+}
@@ -0,0 +1,73 @@
+#ifndef MOSQUITO_POOL_H
+#define MOSQUITO_POOL_H
+
+#include "Trambo/Resources/resourceHolder.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+
+class CulledLayerNode;
+class EventScheduler;
+class FlowField;
+class HouseTileMask;
+class MosquitoNode;
+class Snapshot;
+class SwarmClock;
+
+// ALW - Preallocates dormant MosquitoNodes and attaches them to a layer once, so spawning a mosquito during
+// ALW - the night is a free list pop instead of a heap allocation. The layer owns the nodes. A mosquito lives
+// ALW - until the night ends, so nodes are never handed back. The free list only shrinks, until load() rebuilds
+// ALW - it from the dormant nodes of a snapshot.
+class MosquitoPool
+{
+public:
+	struct Statistics
+	{
+		std::size_t				capacity;
+		std::size_t				active;
+		std::size_t				highWaterMark;
+		std::size_t				allocations;	// ALW - Nodes allocated after initialize(), because the pool ran dry
+		std::size_t				acquisitions;
+	};
+
+
+public:
+								MosquitoPool(const trmb::TextureHolder &textures, sf::FloatRect worldBounds
+									, const HouseTileMask &houseTileMask, const FlowField &flowField, EventScheduler &scheduler
+									, const SwarmClock &swarmClock);
+								MosquitoPool(const MosquitoPool &) = delete;
+	MosquitoPool &				operator=(const MosquitoPool &) = delete;
+
+	const Statistics &			getStatistics() const;
+	const std::vector<MosquitoNode *> &	getMosquitoes() const;	// ALW - Includes dormant mosquitoes
+
+	void						initialize(CulledLayerNode &layer, std::size_t capacity);
+	MosquitoNode &				acquire(sf::Vector2f position);
+
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
+
+private:
+	void						allocate();
+
+
+private:
+	const trmb::TextureHolder	&mTextures;
+	const sf::FloatRect			mWorldBounds;
+	const HouseTileMask			&mHouseTileMask;
+	const FlowField				&mFlowField;
+	EventScheduler				&mScheduler;
+	const SwarmClock			&mSwarmClock;
+	CulledLayerNode				*mLayer;
+
+	std::vector<MosquitoNode *>	mMosquitoes;
+	std::vector<std::size_t>	mFreeList;
+	Statistics					mStatistics;
+};
+
+#endif
@@ -11,23 +11,21 @@ namespace sf
 }
 
 class InteractiveObject;
+class MousePicker;
 class UIBundle;
 
 class PreventionNode : public InteractiveNode
 {
 public:
 								PreventionNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity);
 								PreventionNode(const PreventionNode &) = delete;
 	PreventionNode &			operator=(const PreventionNode &) = delete;
 
 
 private:
 	virtual void				activate() = 0;
-
-
-protected:
-	virtual bool				isMouseOverObject() const override final;
 };
 
 #endif
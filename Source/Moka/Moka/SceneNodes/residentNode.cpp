@@ -1,77 +1,69 @@
 #include "residentNode.h"
+#include "../Application/eventIdentifiers.h"
 #include "houseNode.h"
+#include "interiorBatch.h"
 #include "../GameObjects/interactiveObject.h"
+#include "../Simulation/simulationRandom.h"
+#include "../Simulation/snapshot.h"
+#include "../Simulation/transmissionRates.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Utilities/utility.h"
-
-#include <SFML/System/Time.hpp>
-#include <SFML/System/Vector2.hpp>
 
 #include <cassert>
+#include <limits>
+#include <stdexcept>
 #include <string>
 
 
-ResidentNode::ResidentNode(int residentID, bool hasMalaria, const HouseNode * const houseNode)
-: mBeginSimulationEvent(0x5000e550)
-, mCured0(0xfedc3227, houseNode->getInteractiveObject().getName())
-, mCured1(0x72b8b78e, houseNode->getInteractiveObject().getName())
-, mCured2(0x4f0b0c7a, houseNode->getInteractiveObject().getName())
-, mCured3(0x56549eca, houseNode->getInteractiveObject().getName())
-, mCured4(0xee2c7729, houseNode->getInteractiveObject().getName())
-, mCured5(0x58acae8,  houseNode->getInteractiveObject().getName())
-, mCured6(0x3dadc569, houseNode->getInteractiveObject().getName())
-, mHasMalaria0(0xfd04c534, houseNode->getInteractiveObject().getName())
-, mHasMalaria1(0x9e203fe1, houseNode->getInteractiveObject().getName())
-, mHasMalaria2(0xe146faa8, houseNode->getInteractiveObject().getName())
-, mHasMalaria3(0xd05a9101, houseNode->getInteractiveObject().getName())
-, mHasMalaria4(0x7809a6c,  houseNode->getInteractiveObject().getName())
-, mHasMalaria5(0x8f0a4af3, houseNode->getInteractiveObject().getName())
-, mHasMalaria6(0xc9bc4d1,  houseNode->getInteractiveObject().getName())
-, mResidentID(residentID)
-, mHouseNode(houseNode)
-, mHasMalaria(hasMalaria)
-//, mDebugShape(5.0f, 30u)
+const std::size_t ResidentNode::noResident = std::numeric_limits<std::size_t>::max();
+
+ResidentNode::ResidentNode(const HouseNode * const houseNode, std::size_t residentCount, std::size_t infectedResidentID
+	, InteriorBatch &interiorBatch, InteractiveRegistry::Entity entity)
+: mHouseNode(houseNode)
+, mInteriorBatch(interiorBatch)
+, mEntity(entity)
+, mResidents()
 {
-	generateSpawnPosition(houseNode->getCollisionBox());
+	assert(("The infected resident ID is out of range!", noResident == infectedResidentID || infectedResidentID < residentCount));
+
+	mResidents.reserve(residentCount);
+	for (std::size_t residentID = 0; residentID < residentCount; ++residentID)
+	{
+		const Resident resident = { generateSpawnPosition(), static_cast<std::uint8_t>(residentID / 2)
+			, infectedResidentID == residentID };
+		mResidents.push_back(resident);
+	}
+}
 
-	// ALW - Uncomment to draw a magenta circle at the resident's actual position.
-//	mDebugShape.setFillColor(sf::Color(255u, 0u, 255u, 255u));
-//	mDebugShape.setOutlineColor(sf::Color(0u, 0u, 0u, 255u));
-//	mDebugShape.setOutlineThickness(1.0f);
-//	mDebugShape.setPosition(getPosition());
+std::size_t ResidentNode::getResidentCount() const
+{
+	return mResidents.size();
 }
 
-bool ResidentNode::hasMalaria() const
+bool ResidentNode::hasMalaria(std::size_t residentID) const
 {
-	return mHasMalaria;
+	return mResidents[residentID].infected;
 }
 
-bool ResidentNode::isBitten(int totalMintNets, int totalDamagedNets) const
+bool ResidentNode::isBitten(std::size_t residentID, int totalMintNets, int totalDamagedNets) const
 {
 	const int bitten = 0;
 	bool ret = false;
 
-	if (isNetDamaged(totalDamagedNets))
+	switch (getBedNetState(mResidents[residentID].bed, totalMintNets, totalDamagedNets))
 	{
+	case NetState::Damaged:
 		// ALW - Mosquito has a 20% chance to pass through damaged net and bite resident.
-		const int diceRoll = trmb::randomInt(5);
-
-		if (diceRoll == bitten)
-			ret = true;
-	}
-	else if (isNetMint(totalMintNets, totalDamagedNets))
-	{
+		ret = SimulationRandom::getInstance().randomInt(damagedNetOdds) == bitten;
+		break;
+	case NetState::Mint:
 		// ALW - Mosquito has a 10% chance to pass through mint net and bite resident.
-		const int diceRoll = trmb::randomInt(10);
-
-		if (diceRoll == bitten)
-			ret = true;
-	}
-	else
-	{
+		ret = SimulationRandom::getInstance().randomInt(mintNetOdds) == bitten;
+		break;
+	case NetState::None:
 		// ALW - Mosquito has a 100% chance to pass through no net and bite resident.
 		ret = true;
+		break;
 	}
 
 	return ret;
@@ -89,204 +81,84 @@ bool ResidentNode::isCured(int RDTs, int ACTs) const
 	return ret;
 }
 
-sf::FloatRect ResidentNode::getBoundingRect() const
+sf::FloatRect ResidentNode::getBoundingRect(std::size_t residentID) const
 {
 	const float tileWidth = 64.0f;
 	const float tileHeight = 64.0f;
 
-	return sf::FloatRect(getPosition().x, getPosition().y, tileWidth, tileHeight);
+	const sf::Vector2f position = mResidents[residentID].position;
+	return sf::FloatRect(position.x, position.y, tileWidth, tileHeight);
 }
 
-void ResidentNode::contractMalaria()
+void ResidentNode::contractMalaria(std::size_t residentID)
 {
-	mHasMalaria = true;
-	sendMalariaMsg();
+	mResidents[residentID].infected = true;
+	mInteriorBatch.setResidentInfected(mEntity, residentID, true);
 }
 
-void ResidentNode::handleEvent(const trmb::Event &gameEvent)
-{
-	if (mBeginSimulationEvent == gameEvent.getType())
-	{
-		if (mHasMalaria)
-			sendMalariaMsg(); // ALW - Display patient zero
-	}
-}
-/*
-void ResidentNode::drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const
+void ResidentNode::save(Snapshot &snapshot) const
 {
-	target.draw(mDebugShape);
+	snapshot.write(mResidents.size());
+	for (const Resident &resident : mResidents)
+		snapshot.write(resident.infected);
 }
-*/
-bool ResidentNode::isNetDamaged(int totalDamagedNets) const
+
+void ResidentNode::load(Snapshot &snapshot)
 {
-	bool ret = false;
-	// ALW - ResidentIDs has zero-based numbering, so it is necessary to add 1 before working with it.
-	// ALW - Divide by 2, because there are two residents per bed max.
-	const float sleepingPairs = (mResidentID + 1.0f) / 2.0f;
+	std::size_t residentCount = 0;
+	snapshot.read(residentCount);
+	if (residentCount != mResidents.size())
+		throw std::runtime_error("ALW - Runtime Error: The snapshot was taken on a different map.");
 
-	// ALW - We assume damaged nets come first. Continue reading for explanation.
-	// ALW - Beds are displayed from top to bottom in this order; damaged nets, mint nets, and no nets.
-	// ALW - The ordering is important. If mint nets came before damaged nets and the player does not
-	// ALW - repair the net then the first bed would not have a net. This could leave a bed with a
-	// ALW - damaged net not at full capcity while filling a bed with no net, since the total residents
-	// ALW - per house is not known here the "order" is filled on a first come first served basis.
-	if (sleepingPairs <= totalDamagedNets)
+	for (std::size_t residentID = 0; residentID < mResidents.size(); ++residentID)
 	{
-		ret = true;
+		bool infected = false;
+		snapshot.read(infected);
+
+		// ALW - Only a change is shown, so patient zero stays hidden until the night begins.
+		if (infected != mResidents[residentID].infected)
+		{
+			mResidents[residentID].infected = infected;
+			mInteriorBatch.setResidentInfected(mEntity, residentID, infected);
+		}
 	}
-
-	return ret;
 }
 
-bool ResidentNode::isNetMint(int totalMintNets, int totalDamagedNets) const
+void ResidentNode::handleEvent(const trmb::Event &gameEvent)
 {
-	bool ret = false;
-	const int totalNets = totalDamagedNets + totalMintNets;
-	// ALW - ResidentIDs has zero-based numbering, so it is necessary to add 1 before working with it.
-	// ALW - Divide by 2, because there are two residents per bed max.
-	const float sleepingPairs = (mResidentID + 1.0f) / 2.0f;
-
-	// ALW - Assume mint nets come after damaged nets. Continue reading for explanation.
-	// ALW - Beds are displayed from top to bottom in this order; damaged nets, mint nets, and no nets.
-	// ALW - The ordering is important. If mint nets came before damaged nets and the player does not
-	// ALW - repair the net then the first bed would not have a net. This could leave a bed with a
-	// ALW - damaged net not at full capcity while filling a bed with no net, since the total residents
-	// ALW - per house is not known here the "order" is filled on a first come first served basis.
-	if (totalDamagedNets < sleepingPairs && sleepingPairs <= totalNets)
+	if (Events::BeginSimulation == gameEvent.getType())
 	{
-		ret = true;
+		// ALW - Display patient zero
+		for (std::size_t residentID = 0; residentID < mResidents.size(); ++residentID)
+		{
+			if (mResidents[residentID].infected)
+				mInteriorBatch.setResidentInfected(mEntity, residentID, true);
+		}
 	}
-
-	return ret;
 }
 
 bool ResidentNode::isDiagnosed(int RDTs) const
 {
-	bool ret = false;
-	const int diceRoll = trmb::randomInt(100);
+	const int diceRoll = SimulationRandom::getInstance().randomInt(100);
 
-	switch (RDTs)
-	{
-	case Stock::None:
-		if (diceRoll == 0)
-			ret = true;			// ALW - 1% chance to seek diagnosis
-		break;
-	case Stock::Small:
-		if (diceRoll < 30)
-			ret = true;			// ALW - 30% chance to seek diagnosis
-		break;
-	case Stock::Medium:
-		if (diceRoll < 60)
-			ret = true;			// ALW - 60% chance to seek diagnosis
-		break;
-	case Stock::Large:
-		if (diceRoll < 90)
-			ret = true;			// ALW - 90% chance to seek diagnosis
-		break;
-	default:
-		assert(("The RDTs total is out of range!", false));
-	}
-
-	return ret;
+	return diceRoll < getDiagnosisPercent(RDTs);
 }
 
 bool ResidentNode::isTreated(int ACTs) const
 {
-	bool ret = false;
-	const int diceRoll = trmb::randomInt(100);
+	const int diceRoll = SimulationRandom::getInstance().randomInt(100);
 
-	switch (ACTs)
-	{
-	case Stock::None:
-		if (diceRoll == 0)
-			ret = true;			// ALW - 1% chance to receive treatment
-		break;
-	case Stock::Small:
-		if (diceRoll < 30)
-			ret = true;			// ALW - 30% chance to receive treatment
-		break;
-	case Stock::Medium:
-		if (diceRoll < 60)
-			ret = true;			// ALW - 60% chance to receive treatment
-		break;
-	case Stock::Large:
-		if (diceRoll < 90)
-			ret = true;			// ALW - 90% chance to receive treatment
-		break;
-	default:
-		assert(("The ACTs total is out of range!", false));
-	}
-
-	return ret;
-}
-
-void ResidentNode::sendCureMsg()
-{
-	switch (mResidentID)
-	{
-	case Resident0:
-		sendEvent(mCured0);
-		break;
-	case Resident1:
-		sendEvent(mCured1);
-		break;
-	case Resident2:
-		sendEvent(mCured2);
-		break;
-	case Resident3:
-		sendEvent(mCured3);
-		break;
-	case Resident4:
-		sendEvent(mCured4);
-		break;
-	case Resident5:
-		sendEvent(mCured5);
-		break;
-	case Resident6:
-		sendEvent(mCured6);
-		break;
-	default:
-		assert(("The resident ID is out of range!", false));
-	}
-}
-
-void ResidentNode::sendMalariaMsg()
-{
-	switch (mResidentID)
-	{
-	case Resident0:
-		sendEvent(mHasMalaria0);
-		break;
-	case Resident1:
-		sendEvent(mHasMalaria1);
-		break;
-	case Resident2:
-		sendEvent(mHasMalaria2);
-		break;
-	case Resident3:
-		sendEvent(mHasMalaria3);
-		break;
-	case Resident4:
-		sendEvent(mHasMalaria4);
-		break;
-	case Resident5:
-		sendEvent(mHasMalaria5);
-		break;
-	case Resident6:
-		sendEvent(mHasMalaria6);
-		break;
-	default:
-		assert(("The resident ID is out of range!", false));
-	}
+	return diceRoll < getTreatmentPercent(ACTs);
 }
 
-void ResidentNode::generateSpawnPosition(sf::FloatRect houseBoundingRect)
+sf::Vector2f ResidentNode::generateSpawnPosition() const
 {
 	const float tileWidth = 64.0f;
 	const float tileHeight = 64.0f;
 
-	const std::string style = mHouseNode->getInteractiveObject().getStyle();
-	const int row = trmb::randomInt(2);
+	const sf::FloatRect houseBoundingRect = mHouseNode->getCollisionBox();
+	const std::string &style = mHouseNode->getInteractiveObject().getStyle();
+	const int row = SimulationRandom::getInstance().randomInt(2);
 	int column = 0;
 
 	if (style == "Narrow")
@@ -297,7 +169,7 @@ void ResidentNode::generateSpawnPosition(sf::FloatRect houseBoundingRect)
 	else if (style == "Wide")
 	{
 		// ALW - 2 tiles wide
-		column = trmb::randomInt(2);
+		column = SimulationRandom::getInstance().randomInt(2);
 	}
 	else
 	{
@@ -306,5 +178,5 @@ void ResidentNode::generateSpawnPosition(sf::FloatRect houseBoundingRect)
 
 	const float xResident = houseBoundingRect.left + column * tileWidth;
 	const float yResident = houseBoundingRect.top + row * tileHeight;
-	setPosition(sf::Vector2f(xResident, yResident));
+	return sf::Vector2f(xResident, yResident);
 }
@@ -1,20 +1,18 @@
 #ifndef RESIDENT_NODE_H
 #define RESIDENT_NODE_H
 
-#include "Trambo/Events/eventStr.h"
+#include "../GameObjects/interactiveRegistry.h"
+
 #include "Trambo/Events/eventHandler.h"
 #include "Trambo/SceneNodes/sceneNode.h"
 
 #include <SFML/Graphics/Rect.hpp>
-// #include <SFML/Graphics/CircleShape.hpp>  // ALW - mDebugShape
-// #include <SFML/Graphics/RenderStates.hpp> // ALW - mDebugShape
-// #include <SFML/Graphics/RenderTarget.hpp> // ALW - mDebugShape
+#include <SFML/System/Vector2.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
-namespace sf
-{
-	class Time;
-}
 
 namespace trambo
 {
@@ -22,87 +20,59 @@ namespace trambo
 }
 
 class HouseNode;
+class InteriorBatch;
+class Snapshot;
 
+// ALW - Every resident of a house, kept as compact records. The residents never move once they are placed, so
+// ALW - checking a house is a linear scan over its records. The InteriorBatch draws them.
 class ResidentNode : public trmb::SceneNode, trmb::EventHandler
 {
 public:
-							ResidentNode(int residentID, bool hasMalaria, const HouseNode * const houseNode);
+	struct Resident
+	{
+		sf::Vector2f			position;
+		std::uint8_t			bed;			// ALW - Two residents per bed
+		bool					infected;
+	};
+
+
+public:
+							ResidentNode(const HouseNode * const houseNode, std::size_t residentCount
+								, std::size_t infectedResidentID, InteriorBatch &interiorBatch, InteractiveRegistry::Entity entity);
 							ResidentNode(const ResidentNode &) = delete;
 	ResidentNode &			operator=(const ResidentNode &) = delete;
 
-	bool					hasMalaria() const;
-	bool					isBitten(int totalNewNets, int totalOldNets) const;
+	std::size_t				getResidentCount() const;
+	bool					hasMalaria(std::size_t residentID) const;
+	bool					isBitten(std::size_t residentID, int totalNewNets, int totalOldNets) const;
 	bool					isCured(int RDTs, int ACTs) const;
 
-	virtual sf::FloatRect	getBoundingRect() const override;
+	sf::FloatRect			getBoundingRect(std::size_t residentID) const;
 
-	void					contractMalaria();
+	void					contractMalaria(std::size_t residentID);
 
-	virtual void			handleEvent(const trmb::Event &gameEvent) override final;
+	void					save(Snapshot &snapshot) const;
+	void					load(Snapshot &snapshot);
 
-
-private:
-	enum ResidentCount
-	{
-		Resident0 = 0,
-		Resident1 = 1,
-		Resident2 = 2,
-		Resident3 = 3,
-		Resident4 = 4,
-		Resident5 = 5,
-		Resident6 = 6,
-	};
-
-	enum Stock
-	{
-		None   = 0,
-		Small  = 1,
-		Medium = 2,
-		Large  = 3,
-	};
+	virtual void			handleEvent(const trmb::Event &gameEvent) override final;
 
 
-private:
-	using					EventGuid = unsigned long;
+public:
+	static const std::size_t	noResident;
 
 
 private:
-//	virtual void			drawCurrent(sf::RenderTarget &target, sf::RenderStates states) const override; // ALW - mDebugShape
-
-	bool					isNetDamaged(int totalDamagedNets) const;
-	bool					isNetMint(int totalMintNets, int totalDamagedNets) const;
-
 	bool					isDiagnosed(int RDTs) const;
 	bool					isTreated(int ACTs) const;
 
-	void					sendCureMsg();
-	void					sendMalariaMsg();
-	void					generateSpawnPosition(sf::FloatRect houseBoundingRect);
+	sf::Vector2f			generateSpawnPosition() const;
 
 
 private:
-	const EventGuid         mBeginSimulationEvent;	// ALW - Matches the GUID in the DaylightUI class.
-
-	const trmb::EventStr	mCured0;				// ALW - Is sent from here.
-	const trmb::EventStr	mCured1;				// ALW - Is sent from here.
-	const trmb::EventStr	mCured2;				// ALW - Is sent from here.
-	const trmb::EventStr	mCured3;				// ALW - Is sent from here.
-	const trmb::EventStr	mCured4;				// ALW - Is sent from here.
-	const trmb::EventStr	mCured5;				// ALW - Is sent from here.
-	const trmb::EventStr	mCured6;				// ALW - Is sent from here.
-
-	const trmb::EventStr	mHasMalaria0;			// ALW - Is sent from here.
-	const trmb::EventStr	mHasMalaria1;			// ALW - Is sent from here.
-	const trmb::EventStr	mHasMalaria2;			// ALW - Is sent from here.
-	const trmb::EventStr	mHasMalaria3;			// ALW - Is sent from here.
-	const trmb::EventStr	mHasMalaria4;			// ALW - Is sent from here.
-	const trmb::EventStr	mHasMalaria5;			// ALW - Is sent from here.
-	const trmb::EventStr	mHasMalaria6;			// ALW - Is sent from here.
-
-	const int				mResidentID;
 	const HouseNode * const mHouseNode;
-	bool					mHasMalaria;
-//	sf::CircleShape			mDebugShape;
+	InteriorBatch			&mInteriorBatch;
+	const InteractiveRegistry::Entity	mEntity;
+	std::vector<Resident>	mResidents;
 };
 
 #endif
@@ -0,0 +1,43 @@
+#include "swarmClock.h"
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+
+const int SwarmClock::phaseRange;
+
+std::uint8_t SwarmClock::getPhase(sf::Vector2f spawnPosition)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	// ALW - Neighboring tiles land far apart in the loop.
+	const int column = static_cast<int>(std::floor(spawnPosition.x / tileWidth));
+	const int row = static_cast<int>(std::floor(spawnPosition.y / tileHeight));
+	return static_cast<std::uint8_t>(column * 97 + row * 53);
+}
+
+SwarmClock::SwarmClock()
+: mFrameSize(64, 64)
+, mFrameCount(8)
+, mDuration(sf::seconds(1))
+, mElapsedTime(sf::Time::Zero)
+{
+}
+
+sf::IntRect SwarmClock::getFrameRect(const sf::Texture &texture, std::uint8_t phase) const
+{
+	const int tick = static_cast<int>(phaseRange * mElapsedTime.asMicroseconds() / mDuration.asMicroseconds());
+	const int frame = (tick + phase) % phaseRange * mFrameCount / phaseRange;
+
+	// ALW - Same layout as trmb::Animation. The frames run left to right and wrap onto the next row.
+	const int framesWide = std::max(1, static_cast<int>(texture.getSize().x) / mFrameSize.x);
+	return sf::IntRect(frame % framesWide * mFrameSize.x, frame / framesWide * mFrameSize.y, mFrameSize.x, mFrameSize.y);
+}
+
+void SwarmClock::advance(sf::Time dt)
+{
+	mElapsedTime = sf::microseconds((mElapsedTime + dt).asMicroseconds() % mDuration.asMicroseconds());
+}
@@ -0,0 +1,47 @@
+#ifndef SWARM_CLOCK_H
+#define SWARM_CLOCK_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+
+
+namespace sf
+{
+	class Texture;
+}
+
+// ALW - One clock for every mosquito's wing-beat loop. Each mosquito keeps only a phase, a byte that offsets it
+// ALW - into the loop, and its frame is worked out when it is drawn. Nothing is updated per mosquito, so the cost
+// ALW - of animating the swarm does not grow with its size.
+class SwarmClock
+{
+public:
+	// ALW - Spreads the swarm across the loop, without drawing from the SimulationRandom stream.
+	static std::uint8_t			getPhase(sf::Vector2f spawnPosition);
+
+
+public:
+								SwarmClock();
+								SwarmClock(const SwarmClock &) = delete;
+	SwarmClock &				operator=(const SwarmClock &) = delete;
+
+	sf::IntRect					getFrameRect(const sf::Texture &texture, std::uint8_t phase) const;
+
+	void						advance(sf::Time dt);
+
+
+private:
+	static const int			phaseRange = 256;
+
+
+private:
+	const sf::Vector2i			mFrameSize;
+	const int					mFrameCount;
+	const sf::Time				mDuration;
+	sf::Time					mElapsedTime;		// ALW - Wrapped to the duration, so it never loses precision
+};
+
+#endif
@@ -1,14 +1,15 @@
 #include "windowNode.h"
+#include "../Application/eventIdentifiers.h"
+#include "../Application/voicePool.h"
 #include "../GameObjects/interactiveObject.h"
 #include "../HUD/chatBoxUI.h"
 #include "../HUD/daylightUI.h"
 #include "../HUD/optionsUI.h"
 #include "../HUD/uiBundle.h"
+#include "../Player/mousePicker.h"
 #include "../Resources/resourceIdentifiers.h"
 
 #include "Trambo/Localize/localize.h"
-#include "Trambo/Sounds/soundPlayer.h"
-#include "Trambo/Utilities/utility.h"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -20,26 +21,15 @@
 
 
 WindowNode::WindowNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window, const sf::View &view
-	, UIBundle &uiBundle, const trmb::TextureHolder &textures, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI
-	, ChatBoxUI &chatBoxUI)
-: PreventionNode(interactiveObject, window, view, uiBundle)
-, mWindowUIActivated(0x961e8d0b)
-, mDrawWindowUI(0x30459275)
-, mDoNotDrawWindowUI(0xf83a20bd)
-, mDrawWindowScreenSprite(0x41a9ff51, interactiveObject.getName())
-, mDoNotDrawWindowScreenSprite(0xbfe9d3e6, interactiveObject.getName())
-, mDrawWindowClosedSprite(0xe0f87a29, interactiveObject.getName())
-, mDoNotDrawWindowClosedSprite(0xdeecc064, interactiveObject.getName())
-, mLeftClickPress(0x6955d309)
+	, UIBundle &uiBundle, const MousePicker &mousePicker, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+	, const trmb::TextureHolder &textures, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI, VoicePool &voicePool)
+: PreventionNode(interactiveObject, window, view, uiBundle, mousePicker, registry, entity)
 , mScreenCost(1.0f)
 , mCloseCost(0.5f)
 , mTextures(textures)
-, mSoundPlayer(soundPlayer)
 , mDaylightUI(daylightUI)
 , mChatBoxUI(chatBoxUI)
-, mWindowUIActive(false)
-, mIsWindowScreen(false)
-, mIsWindowClosed(false)
+, mVoicePool(voicePool)
 {
 	mCallbackPairs.emplace_back(CallbackPair(std::bind(&WindowNode::addScreen, this), std::bind(&WindowNode::undoScreen, this)));
 	mCallbackPairs.emplace_back(CallbackPair(std::bind(&WindowNode::closeWindow, this), std::bind(&WindowNode::openWindow, this)));
@@ -49,12 +39,12 @@ WindowNode::WindowNode(const InteractiveObject &interactiveObject, const sf::Ren
 
 bool WindowNode::isWindowScreen() const
 {
-	return mIsWindowScreen;
+	return mRegistry.getPrevention(mEntity).screened;
 }
 
 bool WindowNode::isWindowClosed() const
 {
-	return mIsWindowClosed;
+	return mRegistry.getPrevention(mEntity).closed;
 }
 
 sf::FloatRect WindowNode::getBoundingRect() const
@@ -63,31 +53,6 @@ sf::FloatRect WindowNode::getBoundingRect() const
 		, mInteractiveObject.getCollisionBoxWidth(), mInteractiveObject.getCollisionBoxHeight());
 }
 
-bool WindowNode::passThrough() const
-{
-	const int enter = 0;
-	bool passThrough = false;
-
-	if (mIsWindowClosed)
-	{
-		const int diceRoll = trmb::randomInt(3); // ALW - 1/3 chance to pass through a closed door
-
-		if (diceRoll == enter)
-			passThrough = true;
-	}
-	else if (mIsWindowScreen)
-	{
-		const int diceRoll = trmb::randomInt(5); // ALW - 20% chance to pass through a screened door
-
-		if (diceRoll == enter)
-			passThrough = true;
-	}
-	else
-		passThrough = true; // ALW - 100% chance to pass through a open door
-
-	return passThrough;
-}
-
 void WindowNode::handleEvent(const trmb::Event &gameEvent)
 {
 	InteractiveNode::handleEvent(gameEvent);
@@ -96,50 +61,29 @@ void WindowNode::handleEvent(const trmb::Event &gameEvent)
 	{
 		mUIBundle.getWindowUI().hide();
 	}
-	else if (!mDisableInput
-		  && !isMouseOverUI(mUIBundle.getChatBoxUI().getRect())
-		  && !isMouseOverUI(mUIBundle.getDaylightUI().getRect()))
+	else if (!mDisableInput && !mMousePicker.isMouseOverInputUI())
 	{
-		if (mWindowUIActivated.getType() == gameEvent.getType())
-		{
-			// ALW - This is a workaround to fix an issue where an object had selection and then another object of the same
-			// ALW - type (barrel, door, window, clinic, house) was selected earlier in the SceneNode. What happened was
-			// ALW - the newly selected object would enable the UI, but then the previously selected object would disable the
-			// ALW - UI. This was not an issue in the reverse order. Now when an object is selected it sends a UI activated
-			// ALW - message, so an object later in the SceneNode knows not to disable the UI.
-			mWindowUIActive = true;
-		}
-		else if (mLeftClickPress == gameEvent.getType())
+		if (Events::LeftClickPress == gameEvent.getType())
 		{
 			mPreviousSelectedState = mSelected;
-			if (mSelected && !isMouseOverUI(mUIBundle.getWindowUI().getRect()))
+			if (mSelected && !mMousePicker.isMouseOverUI(MousePicker::UI::Window))
 			{
 				mSelected = false;
 			}
 
-			if (isMouseOverObject()
-				&& !isMouseOverUI(mUIBundle.getBarrelUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getDoorUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getWindowUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getClinicUI().getRect())
-				&& !isMouseOverUI(mUIBundle.getHouseUI().getRect()))
+			// ALW - The MousePicker has already resolved which object, if any, the click landed on.
+			if (mMousePicker.getPickedEntity() == mEntity)
 			{
 				mSelected = true;
 				if (!mPreviousSelectedState)
 					activate();
 			}
 
-			if (mPreviousSelectedState && !mSelected && !mWindowUIActive)
+			if (mPreviousSelectedState && !mSelected && !mMousePicker.isPicked(InteractiveRegistry::Kind::Window))
 			{
-				// ALW - Two scenarios are possible. First, an object earlier in the SceneNode is unselected. The UI
-				// ALW - will be hidden. This behavior is ok, because if an object later in the SceneNode
-				// ALW - is then selected it will unhide itself. Next, the object may be unselected, because the click
-				// ALW - did not occur on an object of the same type. Here the UI is not in use, so resetting and hiding
-				// ALW - the UI is the desired behavior.
+				// ALW - The click did not land on another window, so the UI is no longer in use.
 				mUIBundle.getWindowUI().hide();
 			}
-
-			mWindowUIActive = false;
 		}
 	}
 }
@@ -171,28 +115,16 @@ void WindowNode::updateCurrent(sf::Time)
 void WindowNode::activate()
 {
 	updateUndoUI();
-	mSoundPlayer.play(SoundEffects::ID::Object);
-	InteractiveNode::sendEvent(mWindowUIActivated);
-	// ALW - ChatBoxUI::UpdateText() can generate a mCreatePrompt event when an interactive object
-	// ALW - is selected. This asynchronous event will force InteractiveNode classes to ignore
-	// ALW - left and right click events. Then if <enter> is pressed an mEnter event will be
-	// ALW - generated allowing InteractiveNode classes to handle left and right click events.
-	// ALW - However, if another interactive object is selected that occurs before the currently
-	// ALW - selected interactive object in the SceneNode then this newly selected interactive
-	// ALW - object will cause ChatBoxUI::UpdateText() to be called which generates a mCreatePrompt.
-	// ALW - InteractiveNodes are then forced to ignore left and right click events, so the original
-	// ALW - interactive object will be left selected. To remedy this all InteractiveNodes deselect
-	// ALW - themselves when a mCreatePrompt is generated. Immediately afterwards the InteractiveNode
-	// ALW - that generated the mCreatePrompt is reselected.
-	if (mIsWindowScreen && mIsWindowClosed)
+	mVoicePool.play(SoundEffects::ID::Object);
+	if (isWindowScreen() && isWindowClosed())
 	{
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectScreenClosedWindow"));
 	}
-	else if (mIsWindowScreen)
+	else if (isWindowScreen())
 	{
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectScreenWindow"));
 	}
-	else if (mIsWindowClosed)
+	else if (isWindowClosed())
 	{
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectClosedWindow"));
 	}
@@ -200,8 +132,6 @@ void WindowNode::activate()
 	{
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("inspectWindow"));
 	}
-
-	mSelected = true;
 }
 
 void WindowNode::updateUndoUI()
@@ -219,9 +149,9 @@ void WindowNode::updateUndoUI()
 
 	// ALW - Tells the WindowUINode whether to draw the UI or not.
 	if (mSelected)
-		InteractiveNode::sendEvent(mDrawWindowUI);
+		InteractiveNode::postEvent(Events::DrawWindowUI);
 	else
-		InteractiveNode::sendEvent(mDoNotDrawWindowUI);
+		InteractiveNode::postEvent(Events::DoNotDrawWindowUI);
 }
 
 void WindowNode::addScreen()
@@ -230,8 +160,7 @@ void WindowNode::addScreen()
 
 	if (mDaylightUI.subtract(mScreenCost))
 	{
-		mIsWindowScreen = true;
-		InteractiveNode::sendEvent(mDrawWindowScreenSprite);
+		mRegistry.setScreened(mEntity, true);
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseScreenWindow"));
 		mUIElemStates.at(screenElement) = false;
 	}
@@ -247,8 +176,7 @@ void WindowNode::addScreen()
 
 void WindowNode::undoScreen()
 {
-	mIsWindowScreen = false;
-	InteractiveNode::sendEvent(mDoNotDrawWindowScreenSprite);
+	mRegistry.setScreened(mEntity, false);
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundScreenWindow"));
 	mDaylightUI.add(mScreenCost);
 	const std::size_t screenElement = 0;
@@ -261,8 +189,7 @@ void WindowNode::closeWindow()
 
 	if (mDaylightUI.subtract(mCloseCost))
 	{
-		mIsWindowClosed = true;
-		InteractiveNode::sendEvent(mDrawWindowClosedSprite);
+		mRegistry.setClosed(mEntity, true);
 		mChatBoxUI.updateText(trmb::Localize::getInstance().getString("purchaseClosedWindow"));
 		mUIElemStates.at(windowElement) = false;
 	}
@@ -278,8 +205,7 @@ void WindowNode::closeWindow()
 
 void WindowNode::openWindow()
 {
-	mIsWindowClosed = false;
-	InteractiveNode::sendEvent(mDoNotDrawWindowClosedSprite);
+	mRegistry.setClosed(mEntity, false);
 	mChatBoxUI.updateText(trmb::Localize::getInstance().getString("refundClosedWindow"));
 	mDaylightUI.add(mCloseCost);
 	const std::size_t windowElement = 1;
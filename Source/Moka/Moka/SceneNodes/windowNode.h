@@ -5,7 +5,6 @@
 #include "../HUD/undoUI.h"
 
 #include "Trambo/Events/event.h"
-#include "Trambo/Events/eventStr.h"
 #include "Trambo/Resources/resourceHolder.h"
 
 #include <SFML/Graphics/Sprite.hpp>
@@ -23,15 +22,12 @@ namespace sf
 	class View;
 }
 
-namespace trmb
-{
-	class SoundPlayer;
-}
-
 class ChatBoxUI;
 class DaylightUI;
 class InteractiveObject;
+class MousePicker;
 class UIBundle;
+class VoicePool;
 
 class WindowNode : public PreventionNode
 {
@@ -41,8 +37,10 @@ private:
 
 public:
 								WindowNode(const InteractiveObject &interactiveObject, const sf::RenderWindow &window
-									, const sf::View &view, UIBundle &uiBundle, const trmb::TextureHolder &textures
-									, trmb::SoundPlayer &soundPlayer, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI);
+									, const sf::View &view, UIBundle &uiBundle, const MousePicker &mousePicker
+									, InteractiveRegistry &registry, InteractiveRegistry::Entity entity
+									, const trmb::TextureHolder &textures, DaylightUI &daylightUI, ChatBoxUI &chatBoxUI
+									, VoicePool &voicePool);
 								WindowNode(const WindowNode &) = delete;
 	WindowNode &				operator=(const WindowNode &) = delete;
 
@@ -51,8 +49,6 @@ public:
 
 	virtual sf::FloatRect		getBoundingRect() const override;
 
-	bool						passThrough() const;
-
 	virtual void				handleEvent(const trmb::Event &gameEvent) override final;
 
 
@@ -69,23 +65,12 @@ private:
 
 
 private:
-	const trmb::Event			mWindowUIActivated;
-	const trmb::Event			mDrawWindowUI;
-	const trmb::Event			mDoNotDrawWindowUI;
-	const trmb::EventStr		mDrawWindowScreenSprite;
-	const trmb::EventStr		mDoNotDrawWindowScreenSprite;
-	const trmb::EventStr		mDrawWindowClosedSprite;
-	const trmb::EventStr		mDoNotDrawWindowClosedSprite;
-	const EventGuid				mLeftClickPress;   // ALW - Matches the GUID in the Controller class.
 	const float					mScreenCost;
 	const float					mCloseCost;
 	const trmb::TextureHolder	&mTextures;
-	trmb::SoundPlayer			&mSoundPlayer;
 	DaylightUI					&mDaylightUI;
 	ChatBoxUI					&mChatBoxUI;
-	bool						mWindowUIActive;
-	bool						mIsWindowScreen;
-	bool						mIsWindowClosed;
+	VoicePool					&mVoicePool;
 
 	// ALW - STL containers are used here, so the interface of the UndoUI class is the same for an instance of UndoUI with 
 	// ALW - one or multiple UI elements.
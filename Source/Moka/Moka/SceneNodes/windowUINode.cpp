@@ -1,4 +1,5 @@
 #include "windowUINode.h"
+#include "../Application/eventIdentifiers.h"
 #include "../HUD/UndoUI.h"
 
 #include "Trambo/Events/event.h"
@@ -8,20 +9,18 @@
 
 
 WindowUINode::WindowUINode(const UndoUI &windowUI)
-: mDrawUI(0x30459275)
-, mDoNotDrawUI(0xf83a20bd)
-, mUI(windowUI)
+: mUI(windowUI)
 , mIsDrawn(false)
 {
 }
 
 void WindowUINode::handleEvent(const trmb::Event &gameEvent)
 {
-	if (mDrawUI == gameEvent.getType())
+	if (Events::DrawWindowUI == gameEvent.getType())
 	{
 		mIsDrawn = true;
 	}
-	else if (mDoNotDrawUI == gameEvent.getType())
+	else if (Events::DoNotDrawWindowUI == gameEvent.getType())
 	{
 		mIsDrawn = false;
 	}
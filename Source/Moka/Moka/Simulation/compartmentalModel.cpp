@@ -0,0 +1,434 @@
+#include "compartmentalModel.h"
+#include "snapshot.h"
+#include "transmissionRates.h"
+#include "../GameObjects/flowField.h"
+#include "../GameObjects/houseTileMask.h"
+#include "../GameObjects/interactiveGroup.h"
+#include "../GameObjects/interactiveObject.h"
+#include "../GameObjects/spawnSampler.h"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+
+CompartmentalModel::CompartmentalModel(const InteractiveGroup &interactiveGroup, const HouseTileMask &houseTileMask
+	, const FlowField &flowField)
+: mFlowField(flowField)
+, mTilesWide(interactiveGroup.getWidth())
+, mTilesHigh(interactiveGroup.getHeight())
+, mOutdoor(mTilesWide * mTilesHigh, Compartment{ 0.0f, 0.0f })
+, mNextOutdoor(mTilesWide * mTilesHigh, Compartment{ 0.0f, 0.0f })
+, mHouses()
+, mDoors()
+, mWindows()
+, mBarrelTiles()
+, mCureChance(getCureChance(Stock::None, Stock::None))
+, mMosquitoSpawns(0.0f)
+, mDoorDeflections(0.0f)
+, mWindowDeflections(0.0f)
+, mNetDeflections(0.0f)
+, mCuredResidents(0.0f)
+{
+	build(interactiveGroup, houseTileMask);
+}
+
+std::size_t CompartmentalModel::getHouseCount() const
+{
+	return mHouses.size();
+}
+
+int CompartmentalModel::getResidents(std::size_t houseID) const
+{
+	return mHouses.at(houseID).residents;
+}
+
+float CompartmentalModel::getInfectedResidents(std::size_t houseID) const
+{
+	return mHouses.at(houseID).infectedResidents;
+}
+
+float CompartmentalModel::getIndoorMosquitoes(std::size_t houseID) const
+{
+	const Compartment &mosquitoes = mHouses.at(houseID).mosquitoes;
+	return mosquitoes.susceptible + mosquitoes.infected;
+}
+
+float CompartmentalModel::getIndoorInfectedMosquitoes(std::size_t houseID) const
+{
+	return mHouses.at(houseID).mosquitoes.infected;
+}
+
+float CompartmentalModel::getMosquitoTotal() const
+{
+	float total = 0.0f;
+
+	for (const Compartment &tile : mOutdoor)
+		total += tile.susceptible + tile.infected;
+
+	for (const House &house : mHouses)
+		total += house.mosquitoes.susceptible + house.mosquitoes.infected;
+
+	return total;
+}
+
+float CompartmentalModel::getInfectedMosquitoTotal() const
+{
+	float total = 0.0f;
+
+	for (const Compartment &tile : mOutdoor)
+		total += tile.infected;
+
+	for (const House &house : mHouses)
+		total += house.mosquitoes.infected;
+
+	return total;
+}
+
+float CompartmentalModel::getMosquitoSpawns() const
+{
+	return mMosquitoSpawns;
+}
+
+float CompartmentalModel::getDoorDeflections() const
+{
+	return mDoorDeflections;
+}
+
+float CompartmentalModel::getWindowDeflections() const
+{
+	return mWindowDeflections;
+}
+
+float CompartmentalModel::getNetDeflections() const
+{
+	return mNetDeflections;
+}
+
+float CompartmentalModel::getCuredResidents() const
+{
+	return mCuredResidents;
+}
+
+void CompartmentalModel::setDoorClosed(std::size_t doorID, bool isDoorClosed)
+{
+	mDoors.at(doorID).passThroughChance = getDoorPassThroughChance(isDoorClosed);
+}
+
+void CompartmentalModel::setWindowState(std::size_t windowID, bool isWindowClosed, bool isWindowScreen)
+{
+	mWindows.at(windowID).passThroughChance = getWindowPassThroughChance(isWindowClosed, isWindowScreen);
+}
+
+void CompartmentalModel::setHouseNets(std::size_t houseID, int totalMintNets, int totalDamagedNets)
+{
+	House &house = mHouses.at(houseID);
+
+	// ALW - Residents are not tracked individually, so average the bite chance of each resident's bed.
+	float totalBiteChance = 0.0f;
+	for (int residentID = 0; residentID < house.residents; ++residentID)
+		totalBiteChance += getBiteChance(getNetState(residentID, totalMintNets, totalDamagedNets));
+
+	house.biteChance = house.residents ? totalBiteChance / house.residents : 1.0f;
+}
+
+void CompartmentalModel::setClinicStock(int RDTs, int ACTs)
+{
+	mCureChance = getCureChance(RDTs, ACTs);
+}
+
+void CompartmentalModel::addMosquitoes(int count, const SpawnSampler &spawnSampler)
+{
+	// ALW - Each tile gets its expected share of the swarms the SpawnSampler would place.
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	for (int tile = 0; tile < static_cast<int>(mOutdoor.size()); ++tile)
+	{
+		const sf::Vector2f position((tile % mTilesWide) * tileWidth, (tile / mTilesWide) * tileHeight);
+		mOutdoor[tile].susceptible += count * spawnSampler.getChance(position);
+	}
+}
+
+void CompartmentalModel::addBarrelSpawn(std::size_t barrelID)
+{
+	// ALW - A barrel spawns zero or one mosquitoes with equal chance on a random side of the barrel.
+	// ALW - A side off the map lands on the barrel's own tile. See SpawnSampler::clamp().
+	const float expectedSpawns = 0.5f;
+	const int barrelTile = mBarrelTiles.at(barrelID);
+
+	for (int direction = 0; direction < Direction::Count; ++direction)
+	{
+		const int tile = getNeighborTile(barrelTile, direction);
+		mOutdoor[tile != -1 ? tile : barrelTile].susceptible += expectedSpawns / Direction::Count;
+	}
+
+	mMosquitoSpawns += expectedSpawns;
+}
+
+void CompartmentalModel::infectResident(std::size_t houseID)
+{
+	House &house = mHouses.at(houseID);
+	house.infectedResidents = std::min(house.infectedResidents + 1.0f, static_cast<float>(house.residents));
+}
+
+void CompartmentalModel::step()
+{
+	// ALW - Same order as World::updateCollisions(). Residents are checked before mosquitoes can exit a house.
+	moveOutdoorMosquitoes();
+	residentInteractions();
+	entranceInteractions(mDoors, mDoorDeflections);
+	entranceInteractions(mWindows, mWindowDeflections);
+}
+
+void CompartmentalModel::save(Snapshot &snapshot) const
+{
+	snapshot.write(mOutdoor.size());
+	for (const Compartment &tile : mOutdoor)
+		snapshot.write(tile);
+
+	// ALW - The house, door, and window layouts come from the map. Only what the night changes is saved.
+	snapshot.write(mHouses.size());
+	for (const House &house : mHouses)
+	{
+		snapshot.write(house.infectedResidents);
+		snapshot.write(house.biteChance);
+		snapshot.write(house.mosquitoes);
+	}
+
+	for (const Entrance &door : mDoors)
+		snapshot.write(door.passThroughChance);
+
+	for (const Entrance &window : mWindows)
+		snapshot.write(window.passThroughChance);
+
+	snapshot.write(mCureChance);
+	snapshot.write(mMosquitoSpawns);
+	snapshot.write(mDoorDeflections);
+	snapshot.write(mWindowDeflections);
+	snapshot.write(mNetDeflections);
+	snapshot.write(mCuredResidents);
+}
+
+void CompartmentalModel::load(Snapshot &snapshot)
+{
+	std::size_t tileCount = 0;
+	snapshot.read(tileCount);
+	if (tileCount != mOutdoor.size())
+		throw std::runtime_error("ALW - Runtime Error: The snapshot was taken on a different map.");
+
+	for (Compartment &tile : mOutdoor)
+		snapshot.read(tile);
+
+	std::size_t houseCount = 0;
+	snapshot.read(houseCount);
+	if (houseCount != mHouses.size())
+		throw std::runtime_error("ALW - Runtime Error: The snapshot was taken on a different map.");
+
+	for (House &house : mHouses)
+	{
+		snapshot.read(house.infectedResidents);
+		snapshot.read(house.biteChance);
+		snapshot.read(house.mosquitoes);
+	}
+
+	for (Entrance &door : mDoors)
+		snapshot.read(door.passThroughChance);
+
+	for (Entrance &window : mWindows)
+		snapshot.read(window.passThroughChance);
+
+	snapshot.read(mCureChance);
+	snapshot.read(mMosquitoSpawns);
+	snapshot.read(mDoorDeflections);
+	snapshot.read(mWindowDeflections);
+	snapshot.read(mNetDeflections);
+	snapshot.read(mCuredResidents);
+}
+
+void CompartmentalModel::build(const InteractiveGroup &interactiveGroup, const HouseTileMask &houseTileMask)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	for (const InteractiveObject &interactiveObj : interactiveGroup.getInteractiveObjects())
+	{
+		const std::string &type = interactiveObj.getType();
+		const int tile = getTile(interactiveObj.getCollisionBoxXCoord(), interactiveObj.getCollisionBoxYCoord());
+
+		if (type == "House")
+		{
+			House house = { 0, interactiveObj.getResidents(), 0.0f, 1.0f, Compartment{ 0.0f, 0.0f } };
+			mHouses.push_back(house);
+			setHouseNets(mHouses.size() - 1, 0, interactiveObj.getNets());
+		}
+		else if (type == "Door" || type == "Window")
+		{
+			assert(("The entrance is not on the map!", tile != -1));
+			const sf::Vector2f position(interactiveObj.getCollisionBoxXCoord(), interactiveObj.getCollisionBoxYCoord());
+			const int houseID = houseTileMask.getHouseID(position);
+			assert(("The entrance is not attached to a house!", houseID != HouseTileMask::noHouse));
+
+			// ALW - Mosquitoes exit one tile below a door and one tile above a window.
+			const int exitTile = getNeighborTile(tile, type == "Door" ? Direction::Down : Direction::Up);
+			Entrance entrance = { tile, exitTile != -1 ? exitTile : tile, static_cast<std::size_t>(houseID), 1.0f };
+
+			if (type == "Door")
+				mDoors.push_back(entrance);
+			else
+				mWindows.push_back(entrance);
+		}
+		else if (type == "Barrel")
+		{
+			assert(("The barrel is not on the map!", tile != -1));
+			mBarrelTiles.push_back(tile);
+		}
+	}
+
+	for (int row = 0; row < mTilesHigh; ++row)
+	{
+		for (int column = 0; column < mTilesWide; ++column)
+		{
+			const int houseID = houseTileMask.getHouseID(sf::Vector2f(column * tileWidth, row * tileHeight));
+			if (houseID != HouseTileMask::noHouse)
+				++mHouses.at(houseID).tiles;
+		}
+	}
+}
+
+void CompartmentalModel::moveOutdoorMosquitoes()
+{
+	// ALW - Each mosquito picks one of four directions with the FlowField's odds. Moves that leave the world
+	// ALW - are rejected, so the mosquito stays put. See MosquitoNode::setNextPosition().
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	std::fill(mNextOutdoor.begin(), mNextOutdoor.end(), Compartment{ 0.0f, 0.0f });
+
+	for (int tile = 0; tile < static_cast<int>(mOutdoor.size()); ++tile)
+	{
+		const Compartment &current = mOutdoor[tile];
+		if (current.susceptible == 0.0f && current.infected == 0.0f)
+			continue;
+
+		const sf::Vector2f position((tile % mTilesWide) * tileWidth, (tile / mTilesWide) * tileHeight);
+
+		for (int direction = 0; direction < Direction::Count; ++direction)
+		{
+			const float share = mFlowField.getChance(position, direction);
+			const int neighbor = getNeighborTile(tile, direction);
+			Compartment &next = mNextOutdoor[neighbor != -1 ? neighbor : tile];
+			next.susceptible += current.susceptible * share;
+			next.infected += current.infected * share;
+		}
+	}
+
+	mOutdoor.swap(mNextOutdoor);
+}
+
+void CompartmentalModel::residentInteractions()
+{
+	// ALW - Indoor mosquitoes are spread evenly over the house's tiles, and a mosquito meets every resident
+	// ALW - sharing its tile. The chance of at least one bite uses 1 - e^(-rate), so it stays within [0, 1].
+	for (House &house : mHouses)
+	{
+		if (!house.tiles || !house.residents)
+			continue;
+
+		Compartment &mosquitoes = house.mosquitoes;
+		const float susceptibleResidents = house.residents - house.infectedResidents;
+		const float infectedMosquitoesPerTile = mosquitoes.infected / house.tiles;
+		const float residentsPerTile = static_cast<float>(house.residents) / house.tiles;
+
+		// ALW - Infected mosquitoes biting healthy residents. An RDT and ACT cures some of them.
+		const float infectiousBites = susceptibleResidents * infectedMosquitoesPerTile * house.biteChance;
+		const float transmissions = susceptibleResidents
+			* (1.0f - std::exp(-infectedMosquitoesPerTile * house.biteChance * (1.0f - mCureChance)));
+		mCuredResidents += infectiousBites * mCureChance;
+
+		// ALW - Healthy mosquitoes biting infected residents.
+		const float infections = mosquitoes.susceptible
+			* (1.0f - std::exp(-house.infectedResidents / house.tiles * house.biteChance));
+
+		// ALW - Every meeting that does not end in a bite was deflected by a net.
+		mNetDeflections += (mosquitoes.susceptible + mosquitoes.infected) * residentsPerTile * (1.0f - house.biteChance);
+
+		house.infectedResidents += transmissions;
+		mosquitoes.susceptible -= infections;
+		mosquitoes.infected += infections;
+	}
+}
+
+void CompartmentalModel::entranceInteractions(const std::vector<Entrance> &entrances, float &deflections)
+{
+	for (const Entrance &entrance : entrances)
+	{
+		House &house = mHouses[entrance.houseID];
+		Compartment &indoor = house.mosquitoes;
+		Compartment &outdoor = mOutdoor[entrance.tile];
+		const float chance = entrance.passThroughChance;
+
+		// ALW - Indoor mosquitoes on the entrance's tile exit the house.
+		const float exitShare = house.tiles ? chance / house.tiles : 0.0f;
+		const Compartment exiting = { indoor.susceptible * exitShare, indoor.infected * exitShare };
+
+		// ALW - Outdoor mosquitoes on the entrance's tile either enter the house or are deflected.
+		const Compartment entering = { outdoor.susceptible * chance, outdoor.infected * chance };
+		deflections += (outdoor.susceptible + outdoor.infected) * (1.0f - chance);
+
+		indoor.susceptible += entering.susceptible - exiting.susceptible;
+		indoor.infected += entering.infected - exiting.infected;
+		outdoor.susceptible -= entering.susceptible;
+		outdoor.infected -= entering.infected;
+		mOutdoor[entrance.exitTile].susceptible += exiting.susceptible;
+		mOutdoor[entrance.exitTile].infected += exiting.infected;
+	}
+}
+
+int CompartmentalModel::getTile(float x, float y) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	const int column = static_cast<int>(std::floor(x / tileWidth));
+	const int row = static_cast<int>(std::floor(y / tileHeight));
+
+	if (column < 0 || mTilesWide <= column || row < 0 || mTilesHigh <= row)
+		return -1;
+
+	return row * mTilesWide + column;
+}
+
+int CompartmentalModel::getNeighborTile(int tile, int direction) const
+{
+	const int column = tile % mTilesWide;
+	const int row = tile / mTilesWide;
+	int neighbor = -1;
+
+	switch (direction)
+	{
+	case Direction::Up:
+		if (row > 0)
+			neighbor = tile - mTilesWide;
+		break;
+	case Direction::Down:
+		if (row < mTilesHigh - 1)
+			neighbor = tile + mTilesWide;
+		break;
+	case Direction::Left:
+		if (column > 0)
+			neighbor = tile - 1;
+		break;
+	case Direction::Right:
+		if (column < mTilesWide - 1)
+			neighbor = tile + 1;
+		break;
+	default:
+		assert(("The direction is invalid", false));
+	}
+
+	return neighbor;
+}
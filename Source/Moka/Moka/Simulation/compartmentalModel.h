@@ -0,0 +1,120 @@
+#ifndef COMPARTMENTAL_MODEL_H
+#define COMPARTMENTAL_MODEL_H
+
+#include <cstddef>
+#include <vector>
+
+
+class FlowField;
+class HouseTileMask;
+class InteractiveGroup;
+class Snapshot;
+class SpawnSampler;
+
+// ALW - Mean-field alternative to the agent simulation. Instead of a MosquitoNode per mosquito and a ResidentNode
+// ALW - per resident, susceptible and infected mosquitoes are tracked as counts per outdoor tile and per house, and
+// ALW - residents as counts per house. Each step() is one second, which is the mosquito movement and collision
+// ALW - interval of the agent simulation, and costs the same no matter how many mosquitoes there are. The odds
+// ALW - come from transmissionRates.h, so both simulations agree. Houses, doors, windows, and barrels are
+// ALW - identified by the order they appear in the Interactive objectgroup.
+class CompartmentalModel
+{
+public:
+								CompartmentalModel(const InteractiveGroup &interactiveGroup, const HouseTileMask &houseTileMask
+									, const FlowField &flowField);
+								CompartmentalModel(const CompartmentalModel &) = delete;
+	CompartmentalModel &		operator=(const CompartmentalModel &) = delete;
+
+	std::size_t					getHouseCount() const;
+	int							getResidents(std::size_t houseID) const;
+	float						getInfectedResidents(std::size_t houseID) const;
+	float						getIndoorMosquitoes(std::size_t houseID) const;
+	float						getIndoorInfectedMosquitoes(std::size_t houseID) const;
+	float						getMosquitoTotal() const;
+	float						getInfectedMosquitoTotal() const;
+
+	// ALW - Running totals since the model was built, used to feed the ScoreboardUI.
+	float						getMosquitoSpawns() const;
+	float						getDoorDeflections() const;
+	float						getWindowDeflections() const;
+	float						getNetDeflections() const;
+	float						getCuredResidents() const;
+
+	void						setDoorClosed(std::size_t doorID, bool isDoorClosed);
+	void						setWindowState(std::size_t windowID, bool isWindowClosed, bool isWindowScreen);
+	void						setHouseNets(std::size_t houseID, int totalMintNets, int totalDamagedNets);
+	void						setClinicStock(int RDTs, int ACTs);
+
+	void						addMosquitoes(int count, const SpawnSampler &spawnSampler);
+	void						addBarrelSpawn(std::size_t barrelID);
+	void						infectResident(std::size_t houseID);
+
+	void						step();
+
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
+
+private:
+	enum Direction
+	{
+		Up    = 0,
+		Down  = 1,
+		Left  = 2,
+		Right = 3,
+		Count
+	};
+
+	struct Compartment
+	{
+		float					susceptible;
+		float					infected;
+	};
+
+	struct House
+	{
+		int						tiles;
+		int						residents;
+		float					infectedResidents;
+		float					biteChance;			// ALW - Average over the house's residents
+		Compartment				mosquitoes;
+	};
+
+	struct Entrance
+	{
+		int						tile;
+		int						exitTile;
+		std::size_t				houseID;
+		float					passThroughChance;
+	};
+
+
+private:
+	void						build(const InteractiveGroup &interactiveGroup, const HouseTileMask &houseTileMask);
+	void						moveOutdoorMosquitoes();
+	void						residentInteractions();
+	void						entranceInteractions(const std::vector<Entrance> &entrances, float &deflections);
+	int							getTile(float x, float y) const;
+	int							getNeighborTile(int tile, int direction) const;
+
+
+private:
+	const FlowField				&mFlowField;
+	int							mTilesWide;
+	int							mTilesHigh;
+	std::vector<Compartment>	mOutdoor;
+	std::vector<Compartment>	mNextOutdoor;		// ALW - Scratch buffer reused every step
+	std::vector<House>			mHouses;
+	std::vector<Entrance>		mDoors;
+	std::vector<Entrance>		mWindows;
+	std::vector<int>			mBarrelTiles;
+	float						mCureChance;
+
+	float						mMosquitoSpawns;
+	float						mDoorDeflections;
+	float						mWindowDeflections;
+	float						mNetDeflections;
+	float						mCuredResidents;
+};
+
+#endif
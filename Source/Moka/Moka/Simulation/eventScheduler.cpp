@@ -0,0 +1,267 @@
+#include "eventScheduler.h"
+#include "snapshot.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <utility>
+
+
+const EventScheduler::EventID EventScheduler::noEvent = std::numeric_limits<EventScheduler::EventID>::max();
+const std::size_t EventScheduler::noNode = std::numeric_limits<std::size_t>::max();
+
+EventScheduler::EventScheduler()
+: mTickTime(sf::milliseconds(10))
+, mNodes()
+, mFreeNodes()
+, mWheels()
+, mPendingCount(0)
+, mCurrentTick(0)
+, mTime()
+, mInTick(false)
+, mStopped(false)
+{
+	const Slot emptySlot = { noNode, noNode };
+	for (std::array<Slot, SlotCount> &wheel : mWheels)
+		wheel.fill(emptySlot);
+}
+
+sf::Time EventScheduler::getTime() const
+{
+	return mTime;
+}
+
+bool EventScheduler::isPending(EventID eventID) const
+{
+	return noNode != findNode(eventID);
+}
+
+sf::Time EventScheduler::getTimeUntil(EventID eventID) const
+{
+	const std::size_t index = findNode(eventID);
+	assert(("The event is not pending!", noNode != index));
+	return std::max(sf::Time::Zero, mTickTime * mNodes[index].dueTick - mTime);
+}
+
+EventScheduler::EventID EventScheduler::schedule(sf::Time delay, Callback callback)
+{
+	assert(("An event cannot be scheduled in the past!", sf::Time::Zero <= delay));
+
+	// ALW - Round up to the next tick. Outside of a tick the current tick has already run, so the event waits for the next one.
+	const sf::Int64 tickMicroseconds = mTickTime.asMicroseconds();
+	const sf::Int64 dueTick = ((mTime + delay).asMicroseconds() + tickMicroseconds - 1) / tickMicroseconds;
+	const sf::Int64 earliestTick = mInTick ? mCurrentTick : mCurrentTick + 1;
+
+	const std::size_t index = allocateNode();
+	Node &node = mNodes[index];
+	node.callback = std::move(callback);
+	node.dueTick = std::max(dueTick, earliestTick);
+	insert(index);
+
+	return (static_cast<EventID>(node.generation) << 32) | static_cast<EventID>(index);
+}
+
+void EventScheduler::cancel(EventID eventID)
+{
+	const std::size_t index = findNode(eventID);
+	if (noNode == index)
+		return;
+
+	unlink(index);
+	releaseNode(index);
+}
+
+void EventScheduler::advance(sf::Time dt)
+{
+	const sf::Time until = mTime + dt;
+	const sf::Int64 untilTick = until.asMicroseconds() / mTickTime.asMicroseconds();
+	mStopped = false;
+
+	// ALW - Finish the events left in the current tick when the last advance() was stopped.
+	drainTick();
+
+	while (!mStopped && mCurrentTick < untilTick)
+	{
+		if (0 == mPendingCount)
+		{
+			// ALW - Nothing is scheduled, so the idle ticks are skipped.
+			mCurrentTick = untilTick;
+			break;
+		}
+
+		enterTick(mCurrentTick + 1);
+		drainTick();
+	}
+
+	// ALW - When stopped, the clock stays at the event that stopped it, so the rest of the frame is not simulated.
+	if (!mStopped)
+		mTime = until;
+}
+
+void EventScheduler::stop()
+{
+	mStopped = true;
+}
+
+void EventScheduler::save(Snapshot &snapshot, EventID eventID) const
+{
+	const bool pending = isPending(eventID);
+	snapshot.write(pending);
+	snapshot.writeTime(pending ? getTimeUntil(eventID) : sf::Time::Zero);
+}
+
+EventScheduler::EventID EventScheduler::load(Snapshot &snapshot, EventID eventID, Callback callback)
+{
+	cancel(eventID);
+
+	bool pending = false;
+	snapshot.read(pending);
+	const sf::Time timeUntil = snapshot.readTime();
+
+	if (!pending)
+		return noEvent;
+
+	return schedule(timeUntil, std::move(callback));
+}
+
+std::size_t EventScheduler::findNode(EventID eventID) const
+{
+	const std::size_t index = static_cast<std::size_t>(eventID & 0xffffffffu);
+	const sf::Uint32 generation = static_cast<sf::Uint32>(eventID >> 32);
+
+	if (index >= mNodes.size() || !mNodes[index].pending || generation != mNodes[index].generation)
+		return noNode;
+
+	return index;
+}
+
+std::size_t EventScheduler::allocateNode()
+{
+	std::size_t index = noNode;
+
+	if (mFreeNodes.empty())
+	{
+		const Node node = { Callback(), 0, 0, noNode, noNode, 0, 0, false };
+		index = mNodes.size();
+		mNodes.push_back(node);
+	}
+	else
+	{
+		index = mFreeNodes.back();
+		mFreeNodes.pop_back();
+	}
+
+	mNodes[index].pending = true;
+	++mPendingCount;
+
+	return index;
+}
+
+void EventScheduler::releaseNode(std::size_t index)
+{
+	Node &node = mNodes[index];
+	node.callback = nullptr;
+	node.pending = false;
+	++node.generation;		// ALW - Any EventID still held for this node is no longer pending
+
+	mFreeNodes.push_back(index);
+	--mPendingCount;
+}
+
+void EventScheduler::insert(std::size_t index)
+{
+	Node &node = mNodes[index];
+
+	// ALW - The lowest level whose span holds both the current tick and the due tick.
+	int level = 0;
+	while (level + 1 < LevelCount && (node.dueTick >> (SlotBits * (level + 1))) != (mCurrentTick >> (SlotBits * (level + 1))))
+		++level;
+
+	assert(("The event is scheduled too far in the future!"
+		, (node.dueTick >> (SlotBits * LevelCount)) == (mCurrentTick >> (SlotBits * LevelCount))));
+
+	node.level = level;
+	node.slot = static_cast<int>((node.dueTick >> (SlotBits * level)) & SlotMask);
+	node.previous = mWheels[node.level][node.slot].tail;
+	node.next = noNode;
+
+	Slot &slot = mWheels[node.level][node.slot];
+	if (noNode == slot.tail)
+		slot.head = index;
+	else
+		mNodes[slot.tail].next = index;
+
+	slot.tail = index;
+}
+
+void EventScheduler::unlink(std::size_t index)
+{
+	Node &node = mNodes[index];
+	Slot &slot = mWheels[node.level][node.slot];
+
+	if (noNode == node.previous)
+		slot.head = node.next;
+	else
+		mNodes[node.previous].next = node.next;
+
+	if (noNode == node.next)
+		slot.tail = node.previous;
+	else
+		mNodes[node.next].previous = node.previous;
+
+	node.previous = noNode;
+	node.next = noNode;
+}
+
+void EventScheduler::cascade(int level, int slot)
+{
+	// ALW - Detach the whole list, then insert each event again relative to the new current tick. The list
+	// ALW - is walked in order, so events due in the same tick keep the order they were scheduled in.
+	std::size_t index = mWheels[level][slot].head;
+	mWheels[level][slot].head = noNode;
+	mWheels[level][slot].tail = noNode;
+
+	while (noNode != index)
+	{
+		const std::size_t next = mNodes[index].next;
+		insert(index);
+		index = next;
+	}
+}
+
+void EventScheduler::enterTick(sf::Int64 tick)
+{
+	mCurrentTick = tick;
+	mTime = mTickTime * tick;
+
+	if (0 != (tick & SlotMask))
+		return;
+
+	// ALW - Level 0 wrapped around. Move the events of the next span down, starting with the highest level that wrapped.
+	int top = 1;
+	while (top + 1 < LevelCount && 0 == ((tick >> (SlotBits * top)) & SlotMask))
+		++top;
+
+	for (int level = top; level >= 1; --level)
+		cascade(level, static_cast<int>((tick >> (SlotBits * level)) & SlotMask));
+}
+
+void EventScheduler::drainTick()
+{
+	Slot &slot = mWheels[0][mCurrentTick & SlotMask];
+	mInTick = true;
+
+	while (!mStopped && noNode != slot.head)
+	{
+		const std::size_t index = slot.head;
+		assert(("The event is in the wrong slot!", mCurrentTick == mNodes[index].dueTick));
+
+		// ALW - The callback may schedule more events and reuse this node, so it is taken out first.
+		const Callback callback = std::move(mNodes[index].callback);
+		unlink(index);
+		releaseNode(index);
+		callback();
+	}
+
+	mInTick = false;
+}
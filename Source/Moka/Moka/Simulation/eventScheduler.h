@@ -0,0 +1,108 @@
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
+class Snapshot;
+
+// ALW - A hierarchical timing wheel of callbacks keyed by the simulation time they are due. Mosquito moves, barrel spawns,
+// ALW - collision passes, and the like schedule their next occurrence instead of polling an accumulator every frame.
+// ALW - Due times are rounded up to a 10 ms tick. Level 0 has a slot per tick for the next 256 ticks, and each level above
+// ALW - covers 256 times the span of the one below. Scheduling, cancelling, and firing are O(1). Events in a higher level
+// ALW - are moved down a level each time the level below wraps around. Events due in the same tick run in the order they
+// ALW - were scheduled.
+class EventScheduler
+{
+public:
+	typedef sf::Uint64			EventID;		// ALW - Generation in the high 32 bits and node index in the low 32 bits
+	typedef std::function<void()>	Callback;
+
+
+public:
+	static const EventID		noEvent;
+
+
+public:
+								EventScheduler();
+								EventScheduler(const EventScheduler &) = delete;
+	EventScheduler &			operator=(const EventScheduler &) = delete;
+
+	sf::Time					getTime() const;
+	bool						isPending(EventID eventID) const;
+	sf::Time					getTimeUntil(EventID eventID) const;
+
+	EventID						schedule(sf::Time delay, Callback callback);
+	void						cancel(EventID eventID);
+
+	void						advance(sf::Time dt);
+	void						stop();			// ALW - Ends the current advance() once the running event returns
+
+	// ALW - Writes whether the event is pending and how long until it is due. load() cancels eventID and
+	// ALW - schedules the callback again when the saved event was pending.
+	void						save(Snapshot &snapshot, EventID eventID) const;
+	EventID						load(Snapshot &snapshot, EventID eventID, Callback callback);
+
+
+private:
+	enum
+	{
+		LevelCount = 4,
+		SlotBits   = 8,
+		SlotCount  = 1 << SlotBits,
+		SlotMask   = SlotCount - 1
+	};
+
+	struct Node
+	{
+		Callback				callback;
+		sf::Int64				dueTick;
+		sf::Uint32				generation;
+		std::size_t				previous;
+		std::size_t				next;
+		int						level;
+		int						slot;
+		bool					pending;
+	};
+
+	struct Slot
+	{
+		std::size_t				head;
+		std::size_t				tail;
+	};
+
+
+private:
+	static const std::size_t	noNode;
+
+
+private:
+	std::size_t					findNode(EventID eventID) const;
+	std::size_t					allocateNode();
+	void						releaseNode(std::size_t index);
+	void						insert(std::size_t index);
+	void						unlink(std::size_t index);
+	void						cascade(int level, int slot);
+	void						enterTick(sf::Int64 tick);
+	void						drainTick();
+
+
+private:
+	const sf::Time				mTickTime;
+	std::vector<Node>			mNodes;
+	std::vector<std::size_t>	mFreeNodes;
+	std::array<std::array<Slot, SlotCount>, LevelCount>	mWheels;
+	std::size_t					mPendingCount;
+	sf::Int64					mCurrentTick;		// ALW - Every event due at or before this tick has run
+	sf::Time					mTime;
+	bool						mInTick;			// ALW - Draining the current tick, so an event due now still runs
+	bool						mStopped;
+};
+
+#endif
@@ -0,0 +1,422 @@
+#include "markovEvaluator.h"
+#include "transmissionRates.h"
+#include "../GameObjects/houseTileMask.h"
+#include "../GameObjects/spawnSampler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+
+MarkovEvaluator::MarkovEvaluator(const NightLayout &layout)
+: mLayout(layout)
+, mStepTime(sf::seconds(1.0f))
+, mFlowField(layout.getTilesWide(), layout.getTilesHigh())
+, mCells()
+, mCellIDs()
+, mDoors()
+, mWindows()
+, mBarrelSpawnCells()
+, mStepLayers(1)
+, mMass()
+, mNextMass()
+, mBranches()
+, mPreventions()
+, mBednets()
+, mInfectedResidents()
+, mBarrelTimers()
+, mCureChance(0.0f)
+, mExpectation()
+{
+}
+
+MarkovEvaluator::Expectation MarkovEvaluator::evaluate(const NightSimulation::State &state, sf::Time duration)
+{
+	assert(("The mosquitoes have not rolled their delays yet!", state.nightBegun));
+	assert(("There must be a barrel timer for every barrel!"
+		, state.barrelTimers.size() == mLayout.getRegistry().getEntities(InteractiveRegistry::Kind::Barrel).size()));
+
+	const Expectation expectation = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+	mExpectation = expectation;
+	mPreventions = state.preventions;
+	mBednets = state.bednets;
+	mBarrelTimers = state.barrelTimers;
+	mCureChance = getCureChance(state.RDTs, state.ACTs);
+	mFlowField.build(mLayout.getRegistry(), mPreventions);
+
+	mInfectedResidents.clear();
+	for (const std::vector<bool> &infectedResidents : state.infectedResidents)
+		mInfectedResidents.emplace_back(infectedResidents.begin(), infectedResidents.end());
+
+	// ALW - A delayed mosquito first moves on the step its delay runs out.
+	const sf::Int64 stepMicroseconds = mStepTime.asMicroseconds();
+	std::vector<int> steps;
+	steps.reserve(state.mosquitoes.size());
+	mStepLayers = 1;
+	for (const NightSimulation::Mosquito &mosquito : state.mosquitoes)
+	{
+		steps.push_back(static_cast<int>((mosquito.delay.asMicroseconds() + stepMicroseconds - 1) / stepMicroseconds));
+		mStepLayers = std::max(mStepLayers, steps.back() + 1);
+	}
+
+	buildCells(state);
+
+	mMass.assign(mCells.size() * mStepLayers * 4, 0.0f);
+	mNextMass.assign(mMass.size(), 0.0f);
+	for (std::size_t i = 0; i < state.mosquitoes.size(); ++i)
+	{
+		const NightSimulation::Mosquito &mosquito = state.mosquitoes[i];
+		mMass[getIndex(getCell(mosquito.position), steps[i], mosquito.indoor, mosquito.infected)] += 1.0f;
+	}
+
+	const sf::Int64 stepCount = duration.asMicroseconds() / stepMicroseconds;
+	for (sf::Int64 i = 0; i < stepCount; ++i)
+		step();
+
+	return mExpectation;
+}
+
+void MarkovEvaluator::buildCells(const NightSimulation::State &state)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	const InteractiveRegistry &registry = mLayout.getRegistry();
+
+	mCells.clear();
+	mCellIDs.clear();
+	mDoors.clear();
+	mWindows.clear();
+	mBarrelSpawnCells.clear();
+
+	// ALW - Every position a mosquito starts from, is spawned at, or is put at by an opening.
+	for (const NightSimulation::Mosquito &mosquito : state.mosquitoes)
+		getCell(mosquito.position);
+
+	for (const InteractiveRegistry::Entity barrel : registry.getEntities(InteractiveRegistry::Kind::Barrel))
+	{
+		const sf::FloatRect barrelRect = registry.getCollisionBox(barrel);
+		const sf::Vector2f position(barrelRect.left, barrelRect.top);
+		const sf::Vector2f neighbors[] = { position - sf::Vector2f(0, tileHeight), position + sf::Vector2f(0, tileHeight)
+			, position - sf::Vector2f(tileWidth, 0), position + sf::Vector2f(tileWidth, 0) };
+
+		for (const sf::Vector2f neighbor : neighbors)
+			mBarrelSpawnCells.push_back(getCell(SpawnSampler::clamp(neighbor, mLayout.getWorldBounds())));
+	}
+
+	// ALW - Mosquito exits house one tile below the door, and one tile above the window
+	for (const InteractiveRegistry::Entity door : registry.getEntities(InteractiveRegistry::Kind::Door))
+	{
+		const Opening opening = { door, getCell(registry.getTransform(door) + sf::Vector2f(0, tileHeight))
+			, getCell(registry.getTransform(registry.getAttachedHouse(door))) };
+		mDoors.push_back(opening);
+	}
+
+	for (const InteractiveRegistry::Entity window : registry.getEntities(InteractiveRegistry::Kind::Window))
+	{
+		const Opening opening = { window, getCell(registry.getTransform(window) + sf::Vector2f(0, -tileHeight))
+			, getCell(registry.getTransform(registry.getAttachedHouse(window))) };
+		mWindows.push_back(opening);
+	}
+
+	// ALW - Then every position reachable from those. linkCell() appends the cells it finds, so they are linked too.
+	for (std::size_t cell = 0; cell < mCells.size(); ++cell)
+		linkCell(cell);
+
+	const std::vector<InteractiveRegistry::Entity> &houses = registry.getEntities(InteractiveRegistry::Kind::House);
+	for (Cell &cell : mCells)
+	{
+		const sf::FloatRect mosquitoRect(cell.position.x, cell.position.y, tileWidth, tileHeight);
+
+		for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
+		{
+			if (!mosquitoRect.intersects(registry.getCollisionBox(houses[houseID])))
+				continue;
+
+			const std::vector<sf::FloatRect> &residentRects = mLayout.getResidentRects(houseID);
+			for (std::size_t residentID = 0; residentID < residentRects.size(); ++residentID)
+			{
+				if (mosquitoRect.intersects(residentRects[residentID]))
+					cell.residents.emplace_back(houseID, residentID);
+			}
+		}
+
+		for (std::size_t doorID = 0; doorID < mDoors.size(); ++doorID)
+		{
+			if (mosquitoRect.intersects(registry.getCollisionBox(mDoors[doorID].entity)))
+				cell.doors.push_back(doorID);
+		}
+
+		for (std::size_t windowID = 0; windowID < mWindows.size(); ++windowID)
+		{
+			if (mosquitoRect.intersects(registry.getCollisionBox(mWindows[windowID].entity)))
+				cell.windows.push_back(windowID);
+		}
+	}
+}
+
+void MarkovEvaluator::linkCell(std::size_t cell)
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	const sf::FloatRect worldBounds = mLayout.getWorldBounds();
+	const sf::Vector2f position = mCells[cell].position;
+	const sf::Vector2f neighbors[] = { position - sf::Vector2f(0, tileHeight), position + sf::Vector2f(0, tileHeight)
+		, position - sf::Vector2f(tileWidth, 0), position + sf::Vector2f(tileWidth, 0) };
+
+	for (int direction = 0; direction < FlowField::Direction::Count; ++direction)
+	{
+		const sf::Vector2f neighbor = neighbors[direction];
+		std::size_t outdoorMove = cell;
+		std::size_t indoorMove = cell;
+
+		if (worldBounds.left <= neighbor.x && worldBounds.width > neighbor.x
+			&& worldBounds.top <= neighbor.y && worldBounds.height > neighbor.y)
+		{
+			outdoorMove = getCell(neighbor);
+
+			// ALW - An indoor mosquito stays put when the new tile is not inside a house.
+			if (mLayout.getHouseTileMask().isIndoor(neighbor))
+				indoorMove = outdoorMove;
+		}
+
+		// ALW - getCell() may have grown mCells, so the cell is indexed again.
+		mCells[cell].moves[0][direction] = outdoorMove;
+		mCells[cell].moves[1][direction] = indoorMove;
+		mCells[cell].chances[direction] = mFlowField.getChance(position, direction);
+	}
+}
+
+std::size_t MarkovEvaluator::getCell(sf::Vector2f position)
+{
+	// ALW - Positions are whole pixels, so they are rounded to keep float error from splitting a cell in two.
+	const std::pair<int, int> key(static_cast<int>(std::floor(position.x + 0.5f)), static_cast<int>(std::floor(position.y + 0.5f)));
+
+	const auto found = mCellIDs.find(key);
+	if (found != mCellIDs.end())
+		return found->second;
+
+	Cell cell;
+	cell.position = sf::Vector2f(static_cast<float>(key.first), static_cast<float>(key.second));
+	mCells.push_back(cell);
+	mCellIDs.insert(std::make_pair(key, mCells.size() - 1));
+
+	return mCells.size() - 1;
+}
+
+std::size_t MarkovEvaluator::getIndex(std::size_t cell, int steps, bool indoor, bool infected) const
+{
+	// ALW - Steps left is outermost, so once every delay has run out a pass only covers the first layer. The infected
+	// ALW - and uninfected mass of a mosquito state are next to each other.
+	return ((steps * mCells.size() + cell) * 2 + (indoor ? 1 : 0)) * 2 + (infected ? 1 : 0);
+}
+
+void MarkovEvaluator::step()
+{
+	// ALW - Same order as NightSimulation::step().
+	moveMosquitoes();
+	mosquitoResidentCollisions();
+	mosquitoDoorCollisions();
+	mosquitoWindowCollisions();
+	spawnBarrelMosquitoes();
+}
+
+void MarkovEvaluator::spawnBarrelMosquitoes()
+{
+	const InteractiveRegistry &registry = mLayout.getRegistry();
+	const std::vector<InteractiveRegistry::Entity> &barrels = registry.getEntities(InteractiveRegistry::Kind::Barrel);
+
+	for (std::size_t barrelID = 0; barrelID < barrels.size(); ++barrelID)
+	{
+		if (mPreventions[barrels[barrelID]].covered)
+			continue;
+
+		sf::Time &timer = mBarrelTimers[barrelID];
+		timer += mStepTime;
+		if (timer < mLayout.getBarrelSpawnDelay())
+			continue;
+
+		timer -= mLayout.getBarrelSpawnDelay();
+
+		// ALW - A barrel spawns zero or one mosquito with equal chance, on one of its four neighbors.
+		const float spawnMass = 0.5f;
+		for (std::size_t neighbor = 0; neighbor < 4; ++neighbor)
+			mMass[getIndex(mBarrelSpawnCells[barrelID * 4 + neighbor], 0, false, false)] += spawnMass / 4.0f;
+
+		mExpectation.mosquitoSpawns += spawnMass;
+	}
+}
+
+void MarkovEvaluator::moveMosquitoes()
+{
+	std::fill(mNextMass.begin(), mNextMass.begin() + getIndex(0, mStepLayers, false, false), 0.0f);
+
+	for (int steps = 0; steps < mStepLayers; ++steps)
+	{
+		for (std::size_t cell = 0; cell < mCells.size(); ++cell)
+		{
+			const Cell &from = mCells[cell];
+
+			for (int state = 0; state < 4; ++state)
+			{
+				const bool indoor = 0 != (state & 2);
+				const bool infected = 0 != (state & 1);
+				const float mass = mMass[getIndex(cell, steps, indoor, infected)];
+				if (0.0f == mass)
+					continue;
+
+				if (1 < steps)
+				{
+					mNextMass[getIndex(cell, steps - 1, indoor, infected)] += mass;
+					continue;
+				}
+
+				for (int direction = 0; direction < FlowField::Direction::Count; ++direction)
+					mNextMass[getIndex(from.moves[indoor ? 1 : 0][direction], 0, indoor, infected)] += mass * from.chances[direction];
+			}
+		}
+	}
+
+	mMass.swap(mNextMass);
+
+	// ALW - Every delay ran down by a step, and new mosquitoes have none.
+	mStepLayers = std::max(1, mStepLayers - 1);
+}
+
+void MarkovEvaluator::mosquitoResidentCollisions()
+{
+	const InteractiveRegistry &registry = mLayout.getRegistry();
+	const std::vector<InteractiveRegistry::Entity> &houses = registry.getEntities(InteractiveRegistry::Kind::House);
+
+	// ALW - Only indoor mosquitoes bite, and a bite only moves mass between the uninfected and infected halves of a
+	// ALW - state, so this pass works in place.
+	for (int steps = 0; steps < mStepLayers; ++steps)
+	{
+		for (std::size_t cell = 0; cell < mCells.size(); ++cell)
+		{
+			const std::vector<std::pair<std::size_t, std::size_t>> &residents = mCells[cell].residents;
+			if (residents.empty())
+				continue;
+
+			float &uninfectedMass = mMass[getIndex(cell, steps, true, false)];
+			float &infectedMass = mMass[getIndex(cell, steps, true, true)];
+			if (0.0f == uninfectedMass && 0.0f == infectedMass)
+				continue;
+
+			for (const std::pair<std::size_t, std::size_t> &resident : residents)
+			{
+				const std::size_t houseID = resident.first;
+				const std::size_t residentID = resident.second;
+				const InteractiveRegistry::Bednets &bednets = mBednets[houses[houseID]];
+
+				const NetState netState = getNetState(static_cast<int>(residentID), bednets.mint, bednets.damaged);
+				const float biteChance = getBiteChance(netState);
+				float &infectedChance = mInfectedResidents[houseID][residentID];
+
+				// ALW - Net deflects mosquito
+				mExpectation.netDeflections += (uninfectedMass + infectedMass) * (1.0f - biteChance);
+
+				// ALW - Each infected mosquito bites an uninfected resident, who is then either cured or infected. The
+				// ALW - resident stays uninfected only if every bite is cured or stopped by the net.
+				const float transmitChance = biteChance * (1.0f - mCureChance);
+				const float uninfectedChance = 1.0f - infectedChance;
+				if (0.0f < transmitChance)
+				{
+					const float anyTransmission = 1.0f - std::pow(1.0f - transmitChance, infectedMass);
+					mExpectation.curedResidents += uninfectedChance * mCureChance * biteChance * anyTransmission / transmitChance;
+					mExpectation.transmissions += uninfectedChance * anyTransmission;
+					infectedChance += uninfectedChance * anyTransmission;
+				}
+				else
+				{
+					mExpectation.curedResidents += uninfectedChance * mCureChance * biteChance * infectedMass;
+				}
+
+				// ALW - Transmit malaria to mosquito
+				const float newlyInfectedMass = uninfectedMass * biteChance * infectedChance;
+				uninfectedMass -= newlyInfectedMass;
+				infectedMass += newlyInfectedMass;
+			}
+		}
+	}
+}
+
+void MarkovEvaluator::mosquitoDoorCollisions()
+{
+	mosquitoOpeningCollisions(InteractiveRegistry::Kind::Door, mDoors, mExpectation.doorDeflections);
+}
+
+void MarkovEvaluator::mosquitoWindowCollisions()
+{
+	mosquitoOpeningCollisions(InteractiveRegistry::Kind::Window, mWindows, mExpectation.windowDeflections);
+}
+
+void MarkovEvaluator::mosquitoOpeningCollisions(InteractiveRegistry::Kind kind, const std::vector<Opening> &openings
+	, float &deflections)
+{
+	// ALW - An opening can send mass to a cell that has not been visited yet, so the result goes to the other buffer.
+	std::fill(mNextMass.begin(), mNextMass.begin() + getIndex(0, mStepLayers, false, false), 0.0f);
+
+	for (int steps = 0; steps < mStepLayers; ++steps)
+	{
+		for (std::size_t cell = 0; cell < mCells.size(); ++cell)
+		{
+			const std::vector<std::size_t> &cellOpenings = InteractiveRegistry::Kind::Door == kind ? mCells[cell].doors : mCells[cell].windows;
+
+			for (int state = 0; state < 4; ++state)
+			{
+				const bool indoor = 0 != (state & 2);
+				const bool infected = 0 != (state & 1);
+				const float mass = mMass[getIndex(cell, steps, indoor, infected)];
+				if (0.0f == mass)
+					continue;
+
+				if (cellOpenings.empty())
+				{
+					mNextMass[getIndex(cell, steps, indoor, infected)] += mass;
+					continue;
+				}
+
+				// ALW - Like NightSimulation, every opening is tested against where the mosquito was before the pass,
+				// ALW - but uses whether it is indoor after the openings before it. Each roll splits the mass in two.
+				const Branch start = { cell, indoor, mass };
+				mBranches.assign(1, start);
+
+				for (const std::size_t openingID : cellOpenings)
+				{
+					const Opening &opening = openings[openingID];
+					const InteractiveRegistry::Prevention &prevention = mPreventions[opening.entity];
+					const float passThroughChance = InteractiveRegistry::Kind::Door == kind
+						? getDoorPassThroughChance(prevention.closed) : getWindowPassThroughChance(prevention.closed, prevention.screened);
+
+					const std::size_t branchCount = mBranches.size();
+					for (std::size_t i = 0; i < branchCount; ++i)
+					{
+						const float branchMass = mBranches[i].mass;
+
+						if (mBranches[i].indoor)
+						{
+							// ALW - Mosquito exits house
+							const Branch exit = { opening.exitCell, false, branchMass * passThroughChance };
+							mBranches.push_back(exit);
+						}
+						else
+						{
+							// ALW - Mosquito enters house, or the opening deflects it
+							const Branch enter = { opening.houseCell, true, branchMass * passThroughChance };
+							mBranches.push_back(enter);
+							deflections += branchMass * (1.0f - passThroughChance);
+						}
+
+						mBranches[i].mass = branchMass * (1.0f - passThroughChance);
+					}
+				}
+
+				for (const Branch &branch : mBranches)
+					mNextMass[getIndex(branch.cell, steps, branch.indoor, infected)] += branch.mass;
+			}
+		}
+	}
+
+	mMass.swap(mNextMass);
+}
@@ -0,0 +1,111 @@
+#ifndef MARKOV_EVALUATOR_H
+#define MARKOV_EVALUATOR_H
+
+#include "nightSimulation.h"
+#include "../GameObjects/flowField.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+
+// ALW - Computes the expected outcome of a night without sampling. Instead of moving single mosquitoes, the
+// ALW - probability mass of every mosquito state (position, indoor, infected, and steps left before it moves) is
+// ALW - pushed through the same rules as NightSimulation one step at a time. Movement, doors, windows, nets, and
+// ALW - barrels are exact. A resident's whole joint state with every mosquito is far too large, so each resident
+// ALW - keeps only the probability that they are infected, and mosquitoes are coupled to residents through it. The
+// ALW - mass lives in flat arrays over cell, steps, indoor, and infected, and every step is a pass over them, so
+// ALW - nothing is allocated or looked up once evaluate() has built the cells.
+class MarkovEvaluator
+{
+public:
+	struct Expectation
+	{
+		float									mosquitoSpawns;
+		float									transmissions;
+		float									doorDeflections;
+		float									windowDeflections;
+		float									netDeflections;
+		float									curedResidents;
+	};
+
+
+public:
+								explicit MarkovEvaluator(const NightLayout &layout);
+								MarkovEvaluator(const MarkovEvaluator &) = delete;
+	MarkovEvaluator &			operator=(const MarkovEvaluator &) = delete;
+
+	Expectation					evaluate(const NightSimulation::State &state, sf::Time duration);
+
+
+private:
+	// ALW - A position a mosquito can be at. Every move is a whole tile, so the positions are the tiles plus the few
+	// ALW - offsets the houses, openings, and spawns start from, and what a cell touches never changes in a night.
+	struct Cell
+	{
+		sf::Vector2f							position;
+		std::size_t								moves[2][FlowField::Direction::Count];	// ALW - The cell moved to, outdoor and indoor
+		float									chances[FlowField::Direction::Count];
+		std::vector<std::pair<std::size_t, std::size_t>>	residents;	// ALW - House and resident IDs it overlaps
+		std::vector<std::size_t>				doors;			// ALW - Into mDoors, in registry order
+		std::vector<std::size_t>				windows;		// ALW - Into mWindows, in registry order
+	};
+
+	struct Opening
+	{
+		InteractiveRegistry::Entity				entity;
+		std::size_t								exitCell;		// ALW - Where a mosquito leaving the house goes
+		std::size_t								houseCell;		// ALW - Where a mosquito entering the house goes
+	};
+
+	struct Branch
+	{
+		std::size_t								cell;
+		bool									indoor;
+		float									mass;
+	};
+
+
+private:
+	void						buildCells(const NightSimulation::State &state);
+	void						linkCell(std::size_t cell);
+	std::size_t					getCell(sf::Vector2f position);
+	std::size_t					getIndex(std::size_t cell, int steps, bool indoor, bool infected) const;
+
+	void						step();
+	void						spawnBarrelMosquitoes();
+	void						moveMosquitoes();
+	void						mosquitoResidentCollisions();
+	void						mosquitoDoorCollisions();
+	void						mosquitoWindowCollisions();
+	void						mosquitoOpeningCollisions(InteractiveRegistry::Kind kind, const std::vector<Opening> &openings
+									, float &deflections);
+
+
+private:
+	const NightLayout							&mLayout;
+	const sf::Time								mStepTime;
+	FlowField									mFlowField;
+	std::vector<Cell>							mCells;
+	std::map<std::pair<int, int>, std::size_t>	mCellIDs;				// ALW - Only used while the night is set up
+	std::vector<Opening>						mDoors;
+	std::vector<Opening>						mWindows;
+	std::vector<std::size_t>					mBarrelSpawnCells;		// ALW - The four neighbors of each barrel
+	int											mStepLayers;			// ALW - One more than the most steps any mass has left
+	std::vector<float>							mMass;					// ALW - Indexed by getIndex()
+	std::vector<float>							mNextMass;
+	std::vector<Branch>							mBranches;
+	std::vector<InteractiveRegistry::Prevention>	mPreventions;
+	std::vector<InteractiveRegistry::Bednets>	mBednets;
+	std::vector<std::vector<float>>				mInfectedResidents;		// ALW - Chance each resident is infected
+	std::vector<sf::Time>						mBarrelTimers;
+	float										mCureChance;
+	Expectation									mExpectation;
+};
+
+#endif
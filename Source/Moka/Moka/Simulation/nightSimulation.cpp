@@ -0,0 +1,445 @@
+#include "nightSimulation.h"
+#include "transmissionRates.h"
+#include "../GameObjects/houseTileMask.h"
+#include "../GameObjects/sceneTemplate.h"
+#include "../GameObjects/spawnSampler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <future>
+#include <utility>
+
+
+NightLayout::NightLayout(std::shared_ptr<const SceneTemplate> sceneTemplate
+	, sf::FloatRect worldBounds, sf::Time barrelSpawnDelay
+	, std::vector<std::vector<sf::FloatRect>> residentRects)
+: mSceneTemplate(std::move(sceneTemplate))
+, mWorldBounds(worldBounds)
+, mBarrelSpawnDelay(barrelSpawnDelay)
+, mResidentRects(std::move(residentRects))
+{
+	assert(("There must be a list of residents for every house!"
+		, mResidentRects.size() == getRegistry().getEntities(InteractiveRegistry::Kind::House).size()));
+}
+
+const InteractiveRegistry &NightLayout::getRegistry() const
+{
+	return mSceneTemplate->getRegistry();
+}
+
+const HouseTileMask &NightLayout::getHouseTileMask() const
+{
+	return mSceneTemplate->getHouseTileMask();
+}
+
+sf::FloatRect NightLayout::getWorldBounds() const
+{
+	return mWorldBounds;
+}
+
+int NightLayout::getTilesWide() const
+{
+	const float tileWidth = 64;
+	return static_cast<int>(mWorldBounds.width / tileWidth);
+}
+
+int NightLayout::getTilesHigh() const
+{
+	const float tileHeight = 64;
+	return static_cast<int>(mWorldBounds.height / tileHeight);
+}
+
+sf::Time NightLayout::getBarrelSpawnDelay() const
+{
+	return mBarrelSpawnDelay;
+}
+
+const std::vector<sf::FloatRect> &NightLayout::getResidentRects(std::size_t houseID) const
+{
+	assert(("The house ID is out of range!", houseID < mResidentRects.size()));
+	return mResidentRects[houseID];
+}
+
+NightSimulation::Change NightSimulation::coverBarrel(sf::Time time, InteractiveRegistry::Entity barrel)
+{
+	const Change change = { time, [barrel](State &state) { state.preventions.at(barrel).covered = true; } };
+	return change;
+}
+
+NightSimulation::Change NightSimulation::closeDoor(sf::Time time, InteractiveRegistry::Entity door)
+{
+	const Change change = { time, [door](State &state) { state.preventions.at(door).closed = true; } };
+	return change;
+}
+
+NightSimulation::Change NightSimulation::closeWindow(sf::Time time, InteractiveRegistry::Entity window)
+{
+	const Change change = { time, [window](State &state) { state.preventions.at(window).closed = true; } };
+	return change;
+}
+
+NightSimulation::Change NightSimulation::screenWindow(sf::Time time, InteractiveRegistry::Entity window)
+{
+	const Change change = { time, [window](State &state) { state.preventions.at(window).screened = true; } };
+	return change;
+}
+
+NightSimulation::Change NightSimulation::repairNets(sf::Time time, InteractiveRegistry::Entity house)
+{
+	const Change change = { time, [house](State &state)
+	{
+		InteractiveRegistry::Bednets &bednets = state.bednets.at(house);
+		bednets.mint += bednets.damaged;
+		bednets.damaged = 0;
+	} };
+	return change;
+}
+
+std::vector<NightSimulation::State> NightSimulation::runForks(std::shared_ptr<const NightLayout> layout, const State &state
+	, const std::vector<Fork> &forks, sf::Time duration)
+{
+	std::vector<std::future<State>> futures;
+	futures.reserve(forks.size());
+
+	for (const Fork &fork : forks)
+	{
+		// ALW - Each thread copies the state it forks from, so nothing mutable is shared between the threads.
+		futures.emplace_back(std::async(std::launch::async, [layout, &state, &fork, duration]()
+		{
+			NightSimulation simulation(layout, state, fork);
+			simulation.run(duration);
+			return simulation.getState();
+		}));
+	}
+
+	std::vector<State> states;
+	states.reserve(futures.size());
+	for (std::future<State> &future : futures)
+		states.emplace_back(future.get());
+
+	return states;
+}
+
+NightSimulation::NightSimulation(std::shared_ptr<const NightLayout> layout, const State &state, const Fork &fork)
+: mLayout(std::move(layout))
+, mStepTime(sf::seconds(1.0f))
+, mState(state)
+, mScheduler()
+, mFlowField(mLayout->getTilesWide(), mLayout->getTilesHigh())
+, mGenerator(fork.seed)
+{
+	assert(("The night layout is missing!", mLayout));
+	assert(("There must be a barrel timer for every barrel!"
+		, mState.barrelTimers.size() == mLayout->getRegistry().getEntities(InteractiveRegistry::Kind::Barrel).size()));
+
+	// ALW - The totals count what happens after the fork, so forks can be compared with each other.
+	mState.elapsed = sf::Time::Zero;
+	mState.mosquitoSpawns = 0;
+	mState.transmissions = 0;
+	mState.doorDeflections = 0;
+	mState.windowDeflections = 0;
+	mState.netDeflections = 0;
+	mState.curedResidents = 0;
+
+	// ALW - A fork of build mode begins the night the way the mosquitoes do, with a delay rolled for each one.
+	if (!mState.nightBegun)
+	{
+		std::piecewise_constant_distribution<float> delayDistribution = getSpawnDelayDistribution();
+		for (Mosquito &mosquito : mState.mosquitoes)
+			mosquito.delay = sf::seconds(delayDistribution(mGenerator));
+
+		mState.nightBegun = true;
+	}
+
+	// ALW - Changes are scheduled first, so a change due at the same time as a step is applied before it.
+	for (const Change &change : fork.changes)
+	{
+		const std::function<void(State &)> apply = change.apply;
+		mScheduler.schedule(change.time, [this, apply]()
+		{
+			apply(mState);
+			buildFlowField();
+		});
+	}
+
+	buildFlowField();
+
+	mScheduler.schedule(mStepTime, std::bind(&NightSimulation::step, this));
+}
+
+const NightSimulation::State &NightSimulation::getState() const
+{
+	return mState;
+}
+
+void NightSimulation::run(sf::Time duration)
+{
+	if (mScheduler.getTime() < duration)
+		mScheduler.advance(duration - mScheduler.getTime());
+
+	mState.elapsed = mScheduler.getTime();
+}
+
+void NightSimulation::buildFlowField()
+{
+	mFlowField.build(mLayout->getRegistry(), mState.preventions);
+}
+
+void NightSimulation::step()
+{
+	// ALW - One step is one second, which is both the mosquito movement and the collision interval.
+	mScheduler.schedule(mStepTime, std::bind(&NightSimulation::step, this));
+
+	moveMosquitoes();
+	mosquitoResidentCollisions(); // ALW - Check residents before letting a mosquito exit the house.
+	mosquitoDoorCollisions();
+	mosquitoWindowCollisions();
+	spawnBarrelMosquitoes();
+}
+
+void NightSimulation::spawnBarrelMosquitoes()
+{
+	const InteractiveRegistry &registry = mLayout->getRegistry();
+	const std::vector<InteractiveRegistry::Entity> &barrels = registry.getEntities(InteractiveRegistry::Kind::Barrel);
+
+	for (std::size_t barrelID = 0; barrelID < barrels.size(); ++barrelID)
+	{
+		if (mState.preventions[barrels[barrelID]].covered)
+			continue;
+
+		sf::Time &timer = mState.barrelTimers[barrelID];
+		timer += mStepTime;
+		if (timer < mLayout->getBarrelSpawnDelay())
+			continue;
+
+		timer -= mLayout->getBarrelSpawnDelay();
+
+		const sf::FloatRect barrelRect = registry.getCollisionBox(barrels[barrelID]);
+		const int numberOfMosquitoes = std::uniform_int_distribution<int>(0, 1)(mGenerator);
+		for (int i = 0; i < numberOfMosquitoes; ++i)
+		{
+			const int direction = std::uniform_int_distribution<int>(0, Direction::Count - 1)(mGenerator);
+			const sf::Vector2f position = getNeighbor(sf::Vector2f(barrelRect.left, barrelRect.top), direction);
+			const Mosquito mosquito = { SpawnSampler::clamp(position, mLayout->getWorldBounds()), sf::Time::Zero, false, false };
+			mState.mosquitoes.push_back(mosquito);
+			++mState.mosquitoSpawns;
+		}
+	}
+}
+
+void NightSimulation::moveMosquitoes()
+{
+	const sf::FloatRect worldBounds = mLayout->getWorldBounds();
+
+	for (Mosquito &mosquito : mState.mosquitoes)
+	{
+		if (sf::Time::Zero < mosquito.delay)
+		{
+			mosquito.delay = std::max(sf::Time::Zero, mosquito.delay - mStepTime);
+			if (sf::Time::Zero < mosquito.delay)
+				continue;
+		}
+
+		const int direction = mFlowField.getDirection(mosquito.position
+			, std::uniform_int_distribution<int>(0, FlowField::rollRange - 1)(mGenerator));
+		const sf::Vector2f position = getNeighbor(mosquito.position, direction);
+
+		if (worldBounds.left <= position.x && worldBounds.width > position.x
+			&& worldBounds.top <= position.y && worldBounds.height > position.y)
+		{
+			// ALW - An indoor mosquito stays put when the new tile is not inside a house.
+			if (!mosquito.indoor || mLayout->getHouseTileMask().isIndoor(position))
+				mosquito.position = position;
+		}
+	}
+}
+
+void NightSimulation::mosquitoResidentCollisions()
+{
+	const InteractiveRegistry &registry = mLayout->getRegistry();
+	const std::vector<InteractiveRegistry::Entity> &houses = registry.getEntities(InteractiveRegistry::Kind::House);
+
+	for (Mosquito &mosquito : mState.mosquitoes)
+	{
+		if (!mosquito.indoor)
+			continue;
+
+		const sf::FloatRect mosquitoRect = getBoundingRect(mosquito);
+
+		for (std::size_t houseID = 0; houseID < houses.size(); ++houseID)
+		{
+			const InteractiveRegistry::Entity house = houses[houseID];
+			if (!mosquitoRect.intersects(registry.getCollisionBox(house)))
+				continue;
+
+			const InteractiveRegistry::Bednets &bednets = mState.bednets[house];
+			const std::vector<sf::FloatRect> &residentRects = mLayout->getResidentRects(houseID);
+			std::vector<bool> &infectedResidents = mState.infectedResidents[houseID];
+
+			for (std::size_t residentID = 0; residentID < residentRects.size(); ++residentID)
+			{
+				if (!mosquitoRect.intersects(residentRects[residentID]))
+					continue;
+
+				const NetState netState = getNetState(static_cast<int>(residentID), bednets.mint, bednets.damaged);
+				if (!roll(getBiteChance(netState)))
+				{
+					// ALW - Net deflects mosquito
+					++mState.netDeflections;
+					continue;
+				}
+
+				// ALW - Unlike World, the pass is not cut short at the first transmission. That only paces the
+				// ALW - transmission message for the player.
+				if (mosquito.infected && !infectedResidents[residentID])
+				{
+					if (roll(getCureChance(mState.RDTs, mState.ACTs)))
+					{
+						// ALW - RDT and ACT cures resident
+						++mState.curedResidents;
+					}
+					else
+					{
+						// ALW - Transmit malaria to resident
+						infectedResidents[residentID] = true;
+						++mState.transmissions;
+					}
+				}
+				if (infectedResidents[residentID] && !mosquito.infected)
+				{
+					// ALW - Transmit malaria to mosquito
+					mosquito.infected = true;
+				}
+			}
+		}
+	}
+}
+
+void NightSimulation::mosquitoDoorCollisions()
+{
+	const float tileHeight = 64;
+	const InteractiveRegistry &registry = mLayout->getRegistry();
+	const std::vector<InteractiveRegistry::Entity> &doors = registry.getEntities(InteractiveRegistry::Kind::Door);
+
+	for (Mosquito &mosquito : mState.mosquitoes)
+	{
+		const sf::FloatRect mosquitoRect = getBoundingRect(mosquito);
+
+		for (const InteractiveRegistry::Entity door : doors)
+		{
+			if (!mosquitoRect.intersects(registry.getCollisionBox(door)))
+				continue;
+
+			const InteractiveRegistry::Entity house = registry.getAttachedHouse(door);
+			const bool passThrough = roll(getDoorPassThroughChance(mState.preventions[door].closed));
+
+			if (mosquito.indoor)
+			{
+				if (passThrough)
+				{
+					// ALW - Mosquito exits house one tile below the door
+					mosquito.position = registry.getTransform(door) + sf::Vector2f(0, tileHeight);
+					mosquito.indoor = false;
+				}
+			}
+			else
+			{
+				if (passThrough)
+				{
+					// ALW - Mosquito enters house
+					mosquito.position = registry.getTransform(house);
+					mosquito.indoor = true;
+				}
+				else
+				{
+					// ALW - Door deflects mosquito
+					++mState.doorDeflections;
+				}
+			}
+		}
+	}
+}
+
+void NightSimulation::mosquitoWindowCollisions()
+{
+	const float tileHeight = 64;
+	const InteractiveRegistry &registry = mLayout->getRegistry();
+	const std::vector<InteractiveRegistry::Entity> &windows = registry.getEntities(InteractiveRegistry::Kind::Window);
+
+	for (Mosquito &mosquito : mState.mosquitoes)
+	{
+		const sf::FloatRect mosquitoRect = getBoundingRect(mosquito);
+
+		for (const InteractiveRegistry::Entity window : windows)
+		{
+			if (!mosquitoRect.intersects(registry.getCollisionBox(window)))
+				continue;
+
+			const InteractiveRegistry::Entity house = registry.getAttachedHouse(window);
+			const InteractiveRegistry::Prevention &prevention = mState.preventions[window];
+			const bool passThrough = roll(getWindowPassThroughChance(prevention.closed, prevention.screened));
+
+			if (mosquito.indoor)
+			{
+				if (passThrough)
+				{
+					// ALW - Mosquito exits house one tile above the window
+					mosquito.position = registry.getTransform(window) - sf::Vector2f(0, tileHeight);
+					mosquito.indoor = false;
+				}
+			}
+			else
+			{
+				if (passThrough)
+				{
+					// ALW - Mosquito enters house
+					mosquito.position = registry.getTransform(house);
+					mosquito.indoor = true;
+				}
+				else
+				{
+					// ALW - Window deflects mosquito
+					++mState.windowDeflections;
+				}
+			}
+		}
+	}
+}
+
+sf::Vector2f NightSimulation::getNeighbor(sf::Vector2f position, int direction) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+	sf::Vector2f neighbor;
+
+	switch (direction)
+	{
+	case Direction::Up:
+		neighbor = position - sf::Vector2f(0, tileHeight);
+		break;
+	case Direction::Down:
+		neighbor = position + sf::Vector2f(0, tileHeight);
+		break;
+	case Direction::Left:
+		neighbor = position - sf::Vector2f(tileWidth, 0);
+		break;
+	case Direction::Right:
+		neighbor = position + sf::Vector2f(tileWidth, 0);
+		break;
+	}
+
+	return neighbor;
+}
+
+sf::FloatRect NightSimulation::getBoundingRect(const Mosquito &mosquito) const
+{
+	const float tileWidth = 64;
+	const float tileHeight = 64;
+
+	return sf::FloatRect(mosquito.position.x, mosquito.position.y, tileWidth, tileHeight);
+}
+
+bool NightSimulation::roll(float chance)
+{
+	return std::bernoulli_distribution(chance)(mGenerator);
+}
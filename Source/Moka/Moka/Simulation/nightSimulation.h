@@ -0,0 +1,159 @@
+#ifndef NIGHT_SIMULATION_H
+#define NIGHT_SIMULATION_H
+
+#include "eventScheduler.h"
+#include "../GameObjects/flowField.h"
+#include "../GameObjects/interactiveRegistry.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+class HouseTileMask;
+class SceneTemplate;
+
+// ALW - The parts of the night that never change once it starts. Every fork points at the same NightLayout,
+// ALW - so the map data is shared and only the state a fork can change is copied. The registry is only read
+// ALW - for its map components (kinds, transforms, collision boxes, and attachments), which a game never writes,
+// ALW - so the layout reads them from the SceneTemplate. It holds a reference to the template, so a worker thread
+// ALW - can keep using the layout after the World that built it is gone.
+class NightLayout
+{
+public:
+								NightLayout(std::shared_ptr<const SceneTemplate> sceneTemplate
+									, sf::FloatRect worldBounds, sf::Time barrelSpawnDelay
+									, std::vector<std::vector<sf::FloatRect>> residentRects);
+								NightLayout(const NightLayout &) = delete;
+	NightLayout &				operator=(const NightLayout &) = delete;
+
+	const InteractiveRegistry &	getRegistry() const;
+	const HouseTileMask &		getHouseTileMask() const;
+	sf::FloatRect				getWorldBounds() const;
+	int							getTilesWide() const;
+	int							getTilesHigh() const;
+	sf::Time					getBarrelSpawnDelay() const;
+	const std::vector<sf::FloatRect> &	getResidentRects(std::size_t houseID) const;
+
+
+private:
+	const std::shared_ptr<const SceneTemplate>	mSceneTemplate;
+	const sf::FloatRect							mWorldBounds;
+	const sf::Time								mBarrelSpawnDelay;
+	const std::vector<std::vector<sf::FloatRect>>	mResidentRects;		// ALW - Indexed in the same order as the houses
+};
+
+// ALW - A headless copy of a running night. The SceneNodes draw themselves and talk through the EventHandler, so
+// ALW - they cannot be copied or run off the main thread. Instead World captures a State, and each fork advances
+// ALW - its own copy with its own generator and EventScheduler, following the same rules as the collision pass. A step
+// ALW - runs every second and each change runs at its own time, so run() jumps from one to the next. Changes let a
+// ALW - fork try a different prevention choice, e.g. repairing a house's nets 30 minutes in. Each fork builds its
+// ALW - own FlowField, since a change can cover a barrel.
+class NightSimulation
+{
+public:
+	struct Mosquito
+	{
+		sf::Vector2f			position;
+		sf::Time				delay;			// ALW - Left before the mosquito starts to move
+		bool					infected;
+		bool					indoor;
+	};
+
+	struct State
+	{
+		sf::Time									elapsed;
+		bool										nightBegun;		// ALW - False in build mode, before any mosquito has rolled its delay
+		std::vector<Mosquito>						mosquitoes;
+		std::vector<InteractiveRegistry::Prevention>	preventions;	// ALW - Indexed by entity
+		std::vector<InteractiveRegistry::Bednets>	bednets;			// ALW - Indexed by entity
+		std::vector<std::vector<bool>>				infectedResidents;	// ALW - Indexed in the same order as the houses
+		std::vector<sf::Time>						barrelTimers;		// ALW - Indexed by barrel ID
+		int											RDTs;
+		int											ACTs;
+
+		// ALW - Running totals since the fork was taken.
+		int											mosquitoSpawns;
+		int											transmissions;
+		int											doorDeflections;
+		int											windowDeflections;
+		int											netDeflections;
+		int											curedResidents;
+	};
+
+	struct Change
+	{
+		sf::Time								time;		// ALW - Since the fork was taken
+		std::function<void(State &)>			apply;
+	};
+
+	struct Fork
+	{
+		unsigned int							seed;
+		std::vector<Change>						changes;
+	};
+
+
+public:
+	static Change				coverBarrel(sf::Time time, InteractiveRegistry::Entity barrel);
+	static Change				closeDoor(sf::Time time, InteractiveRegistry::Entity door);
+	static Change				closeWindow(sf::Time time, InteractiveRegistry::Entity window);
+	static Change				screenWindow(sf::Time time, InteractiveRegistry::Entity window);
+	static Change				repairNets(sf::Time time, InteractiveRegistry::Entity house);
+
+	// ALW - Runs every fork on its own thread and blocks until they have all advanced by duration.
+	static std::vector<State>	runForks(std::shared_ptr<const NightLayout> layout, const State &state
+									, const std::vector<Fork> &forks, sf::Time duration);
+
+
+public:
+								NightSimulation(std::shared_ptr<const NightLayout> layout, const State &state, const Fork &fork);
+								NightSimulation(const NightSimulation &) = delete;
+	NightSimulation &			operator=(const NightSimulation &) = delete;
+
+	const State &				getState() const;
+
+	void						run(sf::Time duration);
+
+
+private:
+	enum Direction
+	{
+		Up    = 0,
+		Down  = 1,
+		Left  = 2,
+		Right = 3,
+		Count
+	};
+
+
+private:
+	void						step();
+	void						spawnBarrelMosquitoes();
+	void						moveMosquitoes();
+	void						mosquitoResidentCollisions();
+	void						mosquitoDoorCollisions();
+	void						mosquitoWindowCollisions();
+
+	void						buildFlowField();
+	sf::Vector2f				getNeighbor(sf::Vector2f position, int direction) const;
+	sf::FloatRect				getBoundingRect(const Mosquito &mosquito) const;
+	bool						roll(float chance);
+
+
+private:
+	const std::shared_ptr<const NightLayout>	mLayout;
+	const sf::Time								mStepTime;
+	State										mState;
+	EventScheduler								mScheduler;
+	FlowField									mFlowField;		// ALW - Built from this fork's barrels
+	std::mt19937								mGenerator;
+};
+
+#endif
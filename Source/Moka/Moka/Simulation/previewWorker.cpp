@@ -0,0 +1,207 @@
+#include "previewWorker.h"
+
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+
+namespace
+{
+	// ALW - Runs the forks below normal priority while it is alive, so the main thread gets its frames in first.
+	// ALW - std::async may run a share on a pooled thread, so the priority the thread had is put back.
+	class BackgroundPriority
+	{
+	public:
+#ifdef _WIN32
+		BackgroundPriority()
+		: mPrevious(GetThreadPriority(GetCurrentThread()))
+		{
+			SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+		}
+
+		~BackgroundPriority()
+		{
+			SetThreadPriority(GetCurrentThread(), mPrevious);
+		}
+
+
+	private:
+		const int				mPrevious;
+#else
+		BackgroundPriority()
+		{
+		}
+#endif
+	};
+}
+
+
+PreviewWorker::PreviewWorker()
+: mForkCount(8)
+, mThreadCount(std::max(2u, std::thread::hardware_concurrency()) - 1)	// ALW - hardware_concurrency() is 0 when unknown
+, mSliceTime(sf::seconds(10.0f))
+, mMutex()
+, mCondition()
+, mLayout()
+, mState()
+, mDuration()
+, mRequestID(0)
+, mHasRequest(false)
+, mEstimate()
+, mHasEstimate(false)
+, mQuit(false)
+, mThread()
+{
+	mThread = std::thread(&PreviewWorker::run, this);
+}
+
+PreviewWorker::~PreviewWorker()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mQuit = true;
+		++mRequestID;
+	}
+
+	mCondition.notify_one();
+	mThread.join();
+}
+
+void PreviewWorker::request(std::shared_ptr<const NightLayout> layout, const NightSimulation::State &state, sf::Time duration)
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mLayout = std::move(layout);
+		mState = state;
+		mDuration = duration;
+		++mRequestID;
+		mHasRequest = true;
+		mHasEstimate = false;
+	}
+
+	mCondition.notify_one();
+}
+
+void PreviewWorker::cancel()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mLayout.reset();
+	++mRequestID;
+	mHasRequest = false;
+	mHasEstimate = false;
+}
+
+bool PreviewWorker::poll(Estimate &estimate)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (!mHasEstimate)
+		return false;
+
+	estimate = mEstimate;
+	mHasEstimate = false;
+	return true;
+}
+
+void PreviewWorker::run()
+{
+	for (;;)
+	{
+		std::shared_ptr<const NightLayout> layout;
+		NightSimulation::State state;
+		sf::Time duration;
+		unsigned int requestID = 0;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mCondition.wait(lock, [this]() { return mQuit || mHasRequest; });
+
+			if (mQuit)
+				return;
+
+			layout = std::move(mLayout);
+			state = std::move(mState);
+			duration = mDuration;
+			requestID = mRequestID;
+			mHasRequest = false;
+		}
+
+		// ALW - This thread runs its share of the forks, and one more thread is started for each other share.
+		std::vector<std::future<std::vector<int>>> futures;
+		for (std::size_t firstFork = 1; firstFork < mThreadCount; ++firstFork)
+		{
+			futures.emplace_back(std::async(std::launch::async, [this, &layout, &state, duration, requestID, firstFork]()
+			{
+				return runForks(layout, state, duration, requestID, firstFork);
+			}));
+		}
+
+		std::vector<int> transmissions = runForks(layout, state, duration, requestID, 0);
+		for (std::future<std::vector<int>> &future : futures)
+		{
+			const std::vector<int> share = future.get();
+			transmissions.insert(transmissions.end(), share.begin(), share.end());
+		}
+
+		// ALW - A cancelled share stops early and returns nothing.
+		if (mForkCount != transmissions.size())
+			continue;
+
+		// ALW - Residents infected before the night, e.g. patient zero, are counted like the scoreboard counts them.
+		int infectedResidents = 0;
+		for (const std::vector<bool> &houseResidents : state.infectedResidents)
+			infectedResidents += static_cast<int>(std::count(houseResidents.begin(), houseResidents.end(), true));
+
+		const std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator> range
+			= std::minmax_element(transmissions.cbegin(), transmissions.cend());
+		const int totalTransmissions = std::accumulate(transmissions.cbegin(), transmissions.cend(), 0);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (requestID != mRequestID)
+			continue;
+
+		mEstimate.minInfections = infectedResidents + *range.first;
+		mEstimate.maxInfections = infectedResidents + *range.second;
+		mEstimate.meanInfections = infectedResidents + static_cast<float>(totalTransmissions) / transmissions.size();
+		mHasEstimate = true;
+	}
+}
+
+std::vector<int> PreviewWorker::runForks(const std::shared_ptr<const NightLayout> &layout, const NightSimulation::State &state
+	, sf::Time duration, unsigned int requestID, std::size_t firstFork) const
+{
+	const BackgroundPriority priority;
+	std::vector<int> transmissions;
+
+	for (std::size_t forkID = firstFork; forkID < mForkCount; forkID += mThreadCount)
+	{
+		const NightSimulation::Fork fork = { static_cast<unsigned int>(forkID), std::vector<NightSimulation::Change>() };
+		NightSimulation simulation(layout, state, fork);
+
+		// ALW - The night runs in slices, so a newer request does not wait for a whole night to finish.
+		sf::Time time = sf::Time::Zero;
+		while (time < duration)
+		{
+			if (isCancelled(requestID))
+				return std::vector<int>();
+
+			time = std::min(duration, time + mSliceTime);
+			simulation.run(time);
+		}
+
+		transmissions.push_back(simulation.getState().transmissions);
+	}
+
+	return transmissions;
+}
+
+bool PreviewWorker::isCancelled(unsigned int requestID) const
+{
+	return requestID != mRequestID;
+}
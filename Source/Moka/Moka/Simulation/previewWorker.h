@@ -0,0 +1,73 @@
+#ifndef PREVIEW_WORKER_H
+#define PREVIEW_WORKER_H
+
+#include "nightSimulation.h"
+
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// ALW - Runs a small batch of headless nights on a background thread while the player is buying preventions, so the
+// ALW - range of infections the current plan leads to can be shown before the night starts. A new request cancels the
+// ALW - batch that is running. The forks use fixed seeds, so two plans are compared on the same mosquito rolls and
+// ALW - the range only moves when the plan does. One core is always left for the main thread, so a dual core runs the
+// ALW - forks on one thread, and the forks run below normal priority so the main thread is scheduled ahead of them.
+class PreviewWorker
+{
+public:
+	struct Estimate
+	{
+		int										minInfections;
+		int										maxInfections;
+		float									meanInfections;
+	};
+
+
+public:
+								PreviewWorker();
+								PreviewWorker(const PreviewWorker &) = delete;
+	PreviewWorker &				operator=(const PreviewWorker &) = delete;
+								~PreviewWorker();
+
+	void						request(std::shared_ptr<const NightLayout> layout, const NightSimulation::State &state
+									, sf::Time duration);
+	void						cancel();
+
+	// ALW - Returns true once for every finished batch. Called from the main thread.
+	bool						poll(Estimate &estimate);
+
+
+private:
+	void						run();
+	std::vector<int>			runForks(const std::shared_ptr<const NightLayout> &layout, const NightSimulation::State &state
+									, sf::Time duration, unsigned int requestID, std::size_t firstFork) const;
+	bool						isCancelled(unsigned int requestID) const;
+
+
+private:
+	const std::size_t							mForkCount;
+	const std::size_t							mThreadCount;
+	const sf::Time								mSliceTime;		// ALW - How often a running night checks for a newer request
+
+	std::mutex									mMutex;
+	std::condition_variable						mCondition;
+	std::shared_ptr<const NightLayout>			mLayout;
+	NightSimulation::State						mState;
+	sf::Time									mDuration;
+	std::atomic<unsigned int>					mRequestID;
+	bool										mHasRequest;
+	Estimate									mEstimate;
+	bool										mHasEstimate;
+	bool										mQuit;
+
+	std::thread									mThread;		// ALW - Started last, once every other member is built
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include "simulationRandom.h"
+#include "snapshot.h"
+
+#include <cassert>
+#include <sstream>
+#include <stdexcept>
+
+
+SimulationRandom & SimulationRandom::getInstance()
+{
+	static SimulationRandom instance;
+	return instance;
+}
+
+SimulationRandom::SimulationRandom()
+: mGenerator(std::random_device()())	// ALW - Seed the generator with a random number from hardware
+{
+}
+
+int SimulationRandom::randomInt(int exclusiveMax)
+{
+	assert(("The exclusive max must be positive!", 0 < exclusiveMax));
+
+	std::uniform_int_distribution<int> distribution(0, exclusiveMax - 1);
+	return distribution(mGenerator);
+}
+
+std::mt19937 & SimulationRandom::getGenerator()
+{
+	return mGenerator;
+}
+
+void SimulationRandom::save(Snapshot &snapshot) const
+{
+	// ALW - The standard only guarantees the textual form of the engine state.
+	std::ostringstream state;
+	state << mGenerator;
+	snapshot.writeString(state.str());
+}
+
+void SimulationRandom::load(Snapshot &snapshot)
+{
+	std::istringstream state(snapshot.readString());
+	state >> mGenerator;
+
+	if (!state)
+		throw std::runtime_error("ALW - Runtime Error: The snapshot's random number generator state is not valid.");
+}
@@ -0,0 +1,35 @@
+#ifndef SIMULATION_RANDOM_H
+#define SIMULATION_RANDOM_H
+
+#include <random>
+
+
+class Snapshot;
+
+// ALW - The random number generator behind every dice roll of the night. Trambo's randomInt() keeps its
+// ALW - engine to itself, so the simulation owns one instead. That way the engine state can be written
+// ALW - to a Snapshot and a restored night rolls the same dice it would have rolled.
+class SimulationRandom
+{
+public:
+	static SimulationRandom &	getInstance();
+
+								SimulationRandom(const SimulationRandom &) = delete;
+	SimulationRandom &			operator=(const SimulationRandom &) = delete;
+
+	int							randomInt(int exclusiveMax);
+	std::mt19937 &				getGenerator();
+
+	void						save(Snapshot &snapshot) const;
+	void						load(Snapshot &snapshot);
+
+
+private:
+								SimulationRandom();
+
+
+private:
+	std::mt19937				mGenerator;
+};
+
+#endif
@@ -0,0 +1,80 @@
+#include "snapshot.h"
+
+#include <SFML/Config.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+
+Snapshot::Snapshot()
+: mBuffer()
+, mReadPosition(0)
+{
+}
+
+bool Snapshot::loadFromFile(const std::string &filename)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if (!file)
+		return false;
+
+	// ALW - Read the whole file at once, so restoring is a single copy instead of a read per value.
+	mBuffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	mReadPosition = 0;
+
+	return true;
+}
+
+void Snapshot::saveToFile(const std::string &filename) const
+{
+	std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+	if (!file)
+		throw std::runtime_error("ALW - Runtime Error: Failed to open " + filename);
+
+	file.write(mBuffer.data(), mBuffer.size());
+
+	if (!file)
+		throw std::runtime_error("ALW - Runtime Error: Failed to write " + filename);
+}
+
+void Snapshot::writeTime(sf::Time time)
+{
+	write(time.asMicroseconds());
+}
+
+void Snapshot::writeString(const std::string &string)
+{
+	write(string.size());
+	mBuffer.insert(end(mBuffer), begin(string), end(string));
+}
+
+sf::Time Snapshot::readTime()
+{
+	sf::Int64 microseconds = 0;
+	read(microseconds);
+
+	return sf::microseconds(microseconds);
+}
+
+std::string Snapshot::readString()
+{
+	std::size_t size = 0;
+	read(size);
+
+	std::string string(size, '\0');
+	if (size > 0)
+		readBytes(&string[0], size);
+
+	return string;
+}
+
+void Snapshot::readBytes(void *destination, std::size_t size)
+{
+	if (mBuffer.size() - mReadPosition < size)
+		throw std::runtime_error("ALW - Runtime Error: The snapshot ended before all of its values were read.");
+
+	std::memcpy(destination, mBuffer.data() + mReadPosition, size);
+	mReadPosition += size;
+}
@@ -0,0 +1,62 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+// ALW - A flat binary buffer of the simulation state. Each class that owns part of the night writes its
+// ALW - fields with save() and reads them back in the same order with load(). Values are stored with their
+// ALW - in-memory layout, so a snapshot is only meant to be restored by the same build on the same machine.
+class Snapshot
+{
+public:
+								Snapshot();
+								Snapshot(const Snapshot &) = delete;
+	Snapshot &					operator=(const Snapshot &) = delete;
+
+	bool						loadFromFile(const std::string &filename);
+	void						saveToFile(const std::string &filename) const;
+
+	template <typename T>
+	void						write(const T &value);
+	void						writeTime(sf::Time time);
+	void						writeString(const std::string &string);
+
+	template <typename T>
+	void						read(T &value);
+	sf::Time					readTime();
+	std::string					readString();
+
+
+private:
+	void						readBytes(void *destination, std::size_t size);
+
+
+private:
+	std::vector<char>			mBuffer;
+	std::size_t					mReadPosition;
+};
+
+template <typename T>
+void Snapshot::write(const T &value)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written to a snapshot!");
+
+	const char * const bytes = reinterpret_cast<const char *>(&value);
+	mBuffer.insert(end(mBuffer), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void Snapshot::read(T &value)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read from a snapshot!");
+
+	readBytes(&value, sizeof(T));
+}
+
+#endif
@@ -0,0 +1,176 @@
+#include "transmissionRates.h"
+#include "simulationRandom.h"
+
+#include <cassert>
+#include <vector>
+
+
+NetState getNetState(int residentID, int totalMintNets, int totalDamagedNets)
+{
+	// ALW - ResidentIDs has zero-based numbering. Divide by 2, because there are two residents per bed max.
+	return getBedNetState(residentID / 2, totalMintNets, totalDamagedNets);
+}
+
+NetState getBedNetState(int bed, int totalMintNets, int totalDamagedNets)
+{
+	NetState netState = NetState::None;
+	const int totalNets = totalDamagedNets + totalMintNets;
+
+	// ALW - We assume damaged nets come first and mint nets come after. Continue reading for explanation.
+	// ALW - Beds are displayed from top to bottom in this order; damaged nets, mint nets, and no nets.
+	// ALW - The ordering is important. If mint nets came before damaged nets and the player does not
+	// ALW - repair the net then the first bed would not have a net. This could leave a bed with a
+	// ALW - damaged net not at full capcity while filling a bed with no net, since the total residents
+	// ALW - per house is not known here the "order" is filled on a first come first served basis.
+	if (bed < totalDamagedNets)
+	{
+		netState = NetState::Damaged;
+	}
+	else if (bed < totalNets)
+	{
+		netState = NetState::Mint;
+	}
+
+	return netState;
+}
+
+int getDiagnosisPercent(int RDTs)
+{
+	int percent = 0;
+
+	switch (RDTs)
+	{
+	case Stock::None:
+		percent = 1;			// ALW - 1% chance to seek diagnosis
+		break;
+	case Stock::Small:
+		percent = 30;			// ALW - 30% chance to seek diagnosis
+		break;
+	case Stock::Medium:
+		percent = 60;			// ALW - 60% chance to seek diagnosis
+		break;
+	case Stock::Large:
+		percent = 90;			// ALW - 90% chance to seek diagnosis
+		break;
+	default:
+		assert(("The RDTs total is out of range!", false));
+	}
+
+	return percent;
+}
+
+int getTreatmentPercent(int ACTs)
+{
+	int percent = 0;
+
+	switch (ACTs)
+	{
+	case Stock::None:
+		percent = 1;			// ALW - 1% chance to receive treatment
+		break;
+	case Stock::Small:
+		percent = 30;			// ALW - 30% chance to receive treatment
+		break;
+	case Stock::Medium:
+		percent = 60;			// ALW - 60% chance to receive treatment
+		break;
+	case Stock::Large:
+		percent = 90;			// ALW - 90% chance to receive treatment
+		break;
+	default:
+		assert(("The ACTs total is out of range!", false));
+	}
+
+	return percent;
+}
+
+bool passThroughDoor(bool isDoorClosed)
+{
+	const int enter = 0;
+	bool passThrough = false;
+
+	if (isDoorClosed)
+	{
+		const int diceRoll = SimulationRandom::getInstance().randomInt(closedDoorOdds); // ALW - 1/3 chance to pass through a closed door
+
+		if (diceRoll == enter)
+			passThrough = true;
+	}
+	else
+		passThrough = true; // ALW - 100% chance to pass through a open door
+
+	return passThrough;
+}
+
+bool passThroughWindow(bool isWindowClosed, bool isWindowScreen)
+{
+	const int enter = 0;
+	bool passThrough = false;
+
+	if (isWindowClosed)
+	{
+		const int diceRoll = SimulationRandom::getInstance().randomInt(closedWindowOdds); // ALW - 1/3 chance to pass through a closed window
+
+		if (diceRoll == enter)
+			passThrough = true;
+	}
+	else if (isWindowScreen)
+	{
+		const int diceRoll = SimulationRandom::getInstance().randomInt(screenedWindowOdds); // ALW - 20% chance to pass through a screened window
+
+		if (diceRoll == enter)
+			passThrough = true;
+	}
+	else
+		passThrough = true; // ALW - 100% chance to pass through a open window
+
+	return passThrough;
+}
+
+float getDoorPassThroughChance(bool isDoorClosed)
+{
+	float chance = 1.0f;	// ALW - 100% chance to pass through a open door
+
+	if (isDoorClosed)
+		chance = 1.0f / closedDoorOdds;
+
+	return chance;
+}
+
+float getWindowPassThroughChance(bool isWindowClosed, bool isWindowScreen)
+{
+	float chance = 1.0f;	// ALW - 100% chance to pass through a open window
+
+	if (isWindowClosed)
+		chance = 1.0f / closedWindowOdds;
+	else if (isWindowScreen)
+		chance = 1.0f / screenedWindowOdds;
+
+	return chance;
+}
+
+float getBiteChance(NetState netState)
+{
+	float chance = 1.0f;	// ALW - 100% chance to pass through no net and bite resident
+
+	if (NetState::Damaged == netState)
+		chance = 1.0f / damagedNetOdds;
+	else if (NetState::Mint == netState)
+		chance = 1.0f / mintNetOdds;
+
+	return chance;
+}
+
+float getCureChance(int RDTs, int ACTs)
+{
+	// ALW - A resident must be diagnosed before being treated.
+	return (getDiagnosisPercent(RDTs) / 100.0f) * (getTreatmentPercent(ACTs) / 100.0f);
+}
+
+std::piecewise_constant_distribution<float> getSpawnDelayDistribution()
+{
+	const std::vector<float> intervals = { 0, 1, 2, 3 };
+	const std::vector<float> weights   = { 0.05f, 0.1f, 0.20f };
+
+	return std::piecewise_constant_distribution<float>(intervals.begin(), intervals.end(), weights.begin());
+}
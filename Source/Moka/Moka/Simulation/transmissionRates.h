@@ -0,0 +1,50 @@
+#ifndef TRANSMISSION_RATES_H
+#define TRANSMISSION_RATES_H
+
+#include <random>
+
+// ALW - The odds shared by the agent simulation (a node per mosquito and resident) and the aggregate
+// ALW - simulation (counts per tile and house). Odds are written as 1 in N, so they match the dice rolls.
+
+enum class NetState
+{
+	Damaged,
+	Mint,
+	None
+};
+
+namespace Stock
+{
+	enum Level
+	{
+		None   = 0,
+		Small  = 1,
+		Medium = 2,
+		Large  = 3,
+	};
+}
+
+const int closedDoorOdds     = 3;	// ALW - 1/3 chance to pass through a closed door
+const int closedWindowOdds   = 3;	// ALW - 1/3 chance to pass through a closed window
+const int screenedWindowOdds = 5;	// ALW - 20% chance to pass through a screened window
+const int damagedNetOdds     = 5;	// ALW - 20% chance to pass through a damaged net and bite a resident
+const int mintNetOdds        = 10;	// ALW - 10% chance to pass through a mint net and bite a resident
+
+NetState	getNetState(int residentID, int totalMintNets, int totalDamagedNets);
+NetState	getBedNetState(int bed, int totalMintNets, int totalDamagedNets);
+
+int			getDiagnosisPercent(int RDTs);
+int			getTreatmentPercent(int ACTs);
+
+bool		passThroughDoor(bool isDoorClosed);
+bool		passThroughWindow(bool isWindowClosed, bool isWindowScreen);
+
+float		getDoorPassThroughChance(bool isDoorClosed);
+float		getWindowPassThroughChance(bool isWindowClosed, bool isWindowScreen);
+float		getBiteChance(NetState netState);
+float		getCureChance(int RDTs, int ACTs);
+
+// ALW - Seconds a mosquito waits once the night begins before it starts to move.
+std::piecewise_constant_distribution<float>	getSpawnDelayDistribution();
+
+#endif
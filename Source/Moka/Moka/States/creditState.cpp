@@ -1,4 +1,5 @@
 #include "creditState.h"
+#include "../Application/eventIdentifiers.h"
 #include "../Resources/resourceIdentifiers.h"
 
 #include "Trambo/Events/event.h"
@@ -11,8 +12,6 @@
 
 CreditState::CreditState(trmb::StateStack &stack, trmb::State::Context context)
 : State(stack, context)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
 , mGUIContainer(context.window)
 {
 	// ALW - Calculate x, y coordinates relative to the center of the window,
@@ -66,7 +65,7 @@ bool CreditState::handleEvent(const sf::Event &event)
 void CreditState::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
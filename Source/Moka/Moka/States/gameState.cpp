@@ -1,5 +1,7 @@
 #include "gameState.h"
 #include "stateIdentifiers.h"
+#include "../Application/framePacer.h"
+#include "../Application/voicePool.h"
 #include "../Player/player.h"
 #include "../Resources/resourceIdentifiers.h"
 
@@ -13,7 +15,7 @@
 
 GameState::GameState(trmb::StateStack &stack, trmb::State::Context context)
 : trmb::State(stack, context)
-, mWorld(*context.window, *context.fonts, *context.sounds, *context.music)
+, mWorld(*context.window, *context.fonts, *context.sounds, *context.music, VoicePool::getInstance())
 , mPlayer(*context.player)
 {
 	mPlayer.setMissionStatus(Player::MissionStatus::MissionRunning);
@@ -29,6 +31,9 @@ bool GameState::update(sf::Time dt)
 	mWorld.update(dt);
 	mPlayer.update();
 
+	// ALW - The world is always moving, from the mosquitoes to the clock.
+	FramePacer::getInstance().requestAnimation();
+
 	if (mWorld.isScoreboardFinished())
 	{
 		getContext().music->stop();
@@ -41,11 +46,19 @@ bool GameState::update(sf::Time dt)
 
 bool GameState::handleEvent(const sf::Event &event)
 {
+	mWorld.handleEvent(event);
 	mPlayer.handleEvent(event);
 
 	// Escape pressed, trigger the pause screen
 	if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
 		requestStackPush(States::ID::Pause);
 
+	// ALW - F5 saves the night and F9 restores it. Both are ignored before the night begins, and a snapshot that
+	// ALW - cannot be written or restored leaves the night as it was.
+	if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5)
+		mWorld.saveSnapshot("Data/Snapshot.bin");
+	else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F9)
+		mWorld.loadSnapshot("Data/Snapshot.bin");
+
 	return true;
 }
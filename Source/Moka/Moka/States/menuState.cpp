@@ -1,4 +1,5 @@
 #include "menuState.h"
+#include "../Application/eventIdentifiers.h"
 #include "stateIdentifiers.h"
 #include "../Resources/resourceIdentifiers.h"
 
@@ -16,8 +17,6 @@
 
 MenuState::MenuState(trmb::StateStack& stack, trmb::State::Context context)
 : trmb::State(stack, context)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
 , mControlsInst(trmb::Localize::getInstance().getString("controlsInstUI"), context.fonts->get(Fonts::ID::Main), 13u)
 , mPlusMouseInst("+", context.fonts->get(Fonts::ID::Main), 13u)
 , mEscInst(trmb::Localize::getInstance().getString("escInstUI"), context.fonts->get(Fonts::ID::Main), 13u)
@@ -262,7 +261,7 @@ bool MenuState::handleEvent(const sf::Event& event)
 void MenuState::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
@@ -1,4 +1,5 @@
 #include "pauseState.h"
+#include "../Application/eventIdentifiers.h"
 #include "stateIdentifiers.h"
 #include "../Resources/resourceIdentifiers.h"
 
@@ -17,8 +18,6 @@
 
 PauseState::PauseState(trmb::StateStack& stack, trmb::State::Context context)
 : trmb::State(stack, context)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
 , mBackgroundShape()
 , mPausedText()
 , mGUIContainer(context.window)
@@ -97,7 +96,7 @@ bool PauseState::handleEvent(const sf::Event& event)
 void PauseState::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}
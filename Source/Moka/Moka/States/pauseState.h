@@ -36,18 +36,11 @@ public:
 	virtual void		handleEvent(const trmb::Event &gameEvent);
 
 
-private:
-	typedef unsigned long EventGuid;
-
-
 private:
 	void					repositionGUI();
 
 
 private:
-	const EventGuid					mFullscreen; // ALW - Matches the GUID in the ToggleFullscreen class.
-	const EventGuid					mWindowed;   // ALW - Matches the GUID in the ToggleFullscreen class.
-
 	sf::RectangleShape				mBackgroundShape;
 	sf::Text						mPausedText;
 	std::shared_ptr<trmb::Button>	mReturnButton;
@@ -1,4 +1,5 @@
 #include "titleState.h"
+#include "../Application/eventIdentifiers.h"
 #include "stateIdentifiers.h"
 #include "../Resources/resourceIdentifiers.h"
 
@@ -15,8 +16,6 @@
 
 TitleState::TitleState(trmb::StateStack& stack, trmb::State::Context context)
 : trmb::State(stack, context)
-, mFullscreen(0x5a0d2314)
-, mWindowed(0x11e3c735)
 , mGUIContainer(context.window)
 {
 	trmb::Localize::getInstance().setFilePath("Data/Text/Text.xml");
@@ -92,7 +91,7 @@ bool TitleState::handleEvent(const sf::Event& event)
 void TitleState::handleEvent(const trmb::Event &gameEvent)
 {
 	// ALW - Currently, fullscreen and windowed mode are the same.
-	if (mFullscreen == gameEvent.getType() || mWindowed == gameEvent.getType())
+	if (Events::Fullscreen == gameEvent.getType() || Events::Windowed == gameEvent.getType())
 	{
 		repositionGUI();
 	}